@@ -0,0 +1,113 @@
+/**
+ * @file AlmacenTripletas.h
+ * @brief Almacén de tripletas con presupuesto de memoria y volcado a disco
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef ALMACEN_TRIPLETAS_H
+#define ALMACEN_TRIPLETAS_H
+
+#include "Elementos.h"
+#include "Vista.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Secuencia de tripletas que no ocupa más memoria que un presupuesto
+ *
+ * Las tripletas se acumulan en un bloque en memoria; cuando el bloque se
+ * llena se añade al final de un archivo temporal (ya borrado del directorio
+ * al crearlo, así desaparece aunque el proceso muera) y se empieza otro.
+ * Para leerlas se recorren por bloques, en el orden en que se añadieron.
+ *
+ * Cumple la interfaz de Sumidero (ver NucleoReduccion.h): la reducción puede
+ * emitir directamente en él.
+ *
+ * Con presupuesto 0 no hay límite y nunca se escribe a disco.
+ */
+class AlmacenTripletas {
+private:
+    uint64_t presupuesto;            // Bytes (0 = sin límite)
+    size_t capacidadBloque;          // Tripletas por bloque
+    std::string dirTemporal;
+    std::vector<TripletaCompacta> memoria;
+    std::vector<uint64_t> bloques;   // Tripletas de cada bloque volcado, en orden
+    uint64_t volcadas = 0;
+    int fd = -1;
+    bool fallo = false;
+
+    void volcar();
+    bool leerBloque(uint64_t desde, uint64_t cuenta, std::vector<TripletaCompacta>& buffer) const;
+
+public:
+    /**
+     * @param presupuestoBytes Memoria máxima para tripletas; se reparte entre el
+     *        bloque que se llena y el bloque que se lee al recorrer
+     * @param dir Directorio de los temporales ("" = $TMPDIR o /tmp)
+     */
+    explicit AlmacenTripletas(uint64_t presupuestoBytes = 0, const std::string& dir = "");
+    ~AlmacenTripletas();
+
+    AlmacenTripletas(const AlmacenTripletas&) = delete;
+    AlmacenTripletas& operator=(const AlmacenTripletas&) = delete;
+
+    // Interfaz de Sumidero
+    void reservar(uint64_t total);
+    void operator()(const TripletaCompacta& t) {
+        memoria.push_back(t);
+        if (memoria.size() >= capacidadBloque) volcar();
+    }
+
+    /**
+     * @brief Vacía el almacén y descarta lo volcado
+     */
+    void limpiar();
+
+    /**
+     * @brief Pasa las tripletas en memoria a 'destino' si nunca se volcó nada
+     * @return false si hay bloques en disco (no se mueve nada)
+     */
+    bool extraerMemoria(std::vector<TripletaCompacta>& destino);
+
+    uint64_t size() const { return volcadas + memoria.size(); }
+    bool enDisco() const { return !bloques.empty(); }
+    uint64_t bytesEnDisco() const { return volcadas * sizeof(TripletaCompacta); }
+    uint64_t bytesEnMemoria() const { return memoria.capacity() * sizeof(TripletaCompacta); }
+
+    /**
+     * @brief false si alguna escritura al temporal falló (disco lleno...)
+     */
+    bool ok() const { return !fallo; }
+
+    /**
+     * @brief Recorre las tripletas bloque a bloque, en orden
+     * @param f Función invocada con cada Vista<TripletaCompacta>
+     * @return false si no se pudo leer un bloque volcado
+     */
+    template <typename F>
+    bool recorrerBloques(F&& f) const {
+        std::vector<TripletaCompacta> buffer;
+        uint64_t desde = 0;
+        for (uint64_t cuenta : bloques) {
+            if (!leerBloque(desde, cuenta, buffer)) return false;
+            f(Vista<TripletaCompacta>(buffer));
+            desde += cuenta;
+        }
+        if (!memoria.empty()) f(Vista<TripletaCompacta>(memoria));
+        return true;
+    }
+
+    /**
+     * @brief Recorre las tripletas una a una, en orden
+     */
+    template <typename F>
+    bool recorrer(F&& f) const {
+        return recorrerBloques([&](Vista<TripletaCompacta> bloque) {
+            for (const auto& t : bloque) f(t);
+        });
+    }
+};
+
+#endif // ALMACEN_TRIPLETAS_H
@@ -0,0 +1,62 @@
+/**
+ * @file Analisis.h
+ * @brief Estadísticas y validación de instancias 3DM
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef ANALISIS_H
+#define ANALISIS_H
+
+#include "Reduccion3SATto3DM.h"
+#include <cstdint>
+#include <map>
+
+/**
+ * @brief Grados de los elementos de una dimensión (W, X o Y)
+ */
+struct EstadisticasDimension {
+    uint64_t elementos = 0;     // Tamaño de la dimensión (2·n·m)
+    uint64_t usados = 0;        // Elementos que aparecen en al menos una tripleta
+    uint64_t gradoMinimo = 0;
+    uint64_t gradoMaximo = 0;
+    double gradoMedio = 0.0;
+    std::map<uint64_t, uint64_t> histograma; // grado -> número de elementos con ese grado
+};
+
+/**
+ * @brief Resultado del análisis de una instancia
+ */
+struct EstadisticasInstancia {
+    int n = 0;
+    int m = 0;
+    uint64_t tripletas = 0;
+    uint64_t tripletasAnillo = 0;   // Var-*-True / Var-*-False
+    uint64_t tripletasClausula = 0; // Clausula-*
+    uint64_t tripletasBasura = 0;   // Garbage
+    uint64_t fueraDeRango = 0;      // Tripletas con algún índice >= 2·n·m
+    uint64_t duplicadas = 0;        // Tripletas repetidas (sin contar la primera aparición)
+    EstadisticasDimension w, x, y;
+
+    /**
+     * @brief Todos los elementos usados, sin índices inválidos ni tripletas repetidas
+     */
+    bool valida() const {
+        return fueraDeRango == 0 && duplicadas == 0 &&
+               w.usados == w.elementos && x.usados == x.elementos && y.usados == y.elementos;
+    }
+};
+
+/**
+ * @brief Calcula grados, histogramas, tipos de tripleta y validez en paralelo
+ *
+ * Cada hilo recorre un tramo contiguo de tripletas una sola vez, acumulando
+ * grados en sus propios contadores; después se suman por rangos de elementos.
+ * Las duplicadas se cuentan aparte, repartiendo las tripletas por su hash.
+ *
+ * @param instancia Instancia a analizar
+ * @param hilos Número de hilos (0 = los del sistema)
+ */
+EstadisticasInstancia analizarInstancia(const InstanciaVista& instancia, unsigned hilos = 0);
+
+#endif // ANALISIS_H
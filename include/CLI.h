@@ -0,0 +1,28 @@
+/**
+ * @file CLI.h
+ * @brief Modo no interactivo (línea de comandos)
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef CLI_H
+#define CLI_H
+
+/**
+ * @brief Ejecuta la orden indicada en los argumentos del programa
+ *
+ * Se usa cuando el programa recibe argumentos; sin ellos se abre el menú
+ * interactivo. No muestra banners ni animaciones.
+ *
+ * @param argc Número de argumentos
+ * @param argv Argumentos (argv[1] es la orden, ej: --codificar)
+ * @return Código de salida del proceso
+ */
+int ejecutarLineaComandos(int argc, char* argv[]);
+
+/**
+ * @brief Muestra las órdenes disponibles en modo no interactivo
+ */
+void mostrarUsoLineaComandos();
+
+#endif // CLI_H
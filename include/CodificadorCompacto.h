@@ -0,0 +1,177 @@
+/**
+ * @file CodificadorCompacto.h
+ * @brief Codificación estructurada (bloques + delta/varint) del conjunto M
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef CODIFICADOR_COMPACTO_H
+#define CODIFICADOR_COMPACTO_H
+
+#include "Elementos.h"
+#include "Gadgets.h"
+#include "Vista.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Codificador del flujo de tripletas que aprovecha la estructura de los gadgets
+ *
+ * Los anillos de variables y los pares de basura se guardan sólo con sus
+ * parámetros (la variable o el índice k); el decodificador los regenera con
+ * los mismos generadores de Gadgets.h. Todo lo que no encaja en un bloque
+ * conocido (las tripletas de cláusulas, o cualquier otra excepción) se guarda
+ * literalmente con deltas en zigzag codificados como varint.
+ *
+ * Formato:
+ *   "3DMZ" version n m totalTripletas numBloques bloque*
+ *   bloque := ANILLO var | BASURA k | BASURA_ETAPA k | LITERAL cuenta (dw dx dy)*
+ *
+ * BASURA_ETAPA es el par k de la variante por etapas (emitirBasuraEtapa).
+ */
+class CodificadorCompacto {
+public:
+    static const uint8_t VERSION = 1;
+
+    enum TipoBloque : uint8_t {
+        BLOQUE_ANILLO = 1,
+        BLOQUE_BASURA = 2,
+        BLOQUE_LITERAL = 3,
+        BLOQUE_BASURA_ETAPA = 4
+    };
+
+    /**
+     * @brief Codifica un flujo de tripletas de una instancia con n variables y m cláusulas
+     */
+    static std::vector<uint8_t> codificar(int n, int m, Vista<TripletaCompacta> tripletas);
+
+    /**
+     * @brief Regenera las tripletas de una codificación, en el orden original
+     * @param maxTotal Tripletas que acepta el llamador: un archivo pequeño puede
+     *        declarar un total enorme (un bloque de basura son 2·n·m tripletas)
+     * @param emitir Función invocada con cada TripletaCompacta
+     * @return false si los datos están corruptos o truncados, o si el total de
+     *         la cabecera supera maxTotal. Antes de cada bloque se comprueba
+     *         que no supere ese total, así que nunca se emiten más tripletas.
+     */
+    template <typename F>
+    static bool recorrer(const std::vector<uint8_t>& datos, uint64_t maxTotal, int& n, int& m, F&& emitir);
+
+    /**
+     * @brief Regenera todas las tripletas en un vector
+     * @return false si los datos están corruptos o truncados, o si hay más de maxTotal tripletas
+     */
+    static bool decodificar(const std::vector<uint8_t>& datos, uint64_t maxTotal, int& n, int& m,
+                            std::vector<TripletaCompacta>& tripletas);
+
+    static bool guardarArchivo(const std::string& filepath, const std::vector<uint8_t>& datos);
+    static bool leerArchivo(const std::string& filepath, std::vector<uint8_t>& datos);
+
+private:
+    // Lectura secuencial con comprobación de límites
+    struct Lector {
+        const uint8_t* p;
+        const uint8_t* fin;
+        bool ok;
+
+        uint64_t varint() {
+            uint64_t v = 0;
+            for (int desplazamiento = 0; desplazamiento < 64; desplazamiento += 7) {
+                if (p == fin) { ok = false; return 0; }
+                uint8_t b = *p++;
+                v |= (uint64_t)(b & 0x7f) << desplazamiento;
+                if (!(b & 0x80)) return v;
+            }
+            ok = false;
+            return 0;
+        }
+
+        int64_t zigzag() {
+            uint64_t v = varint();
+            return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+        }
+
+        uint8_t byte() {
+            if (p == fin) { ok = false; return 0; }
+            return *p++;
+        }
+    };
+};
+
+template <typename F>
+bool CodificadorCompacto::recorrer(const std::vector<uint8_t>& datos, uint64_t maxTotal, int& n, int& m,
+                                   F&& emitir) {
+    Lector in{datos.data(), datos.data() + datos.size(), true};
+
+    if (datos.size() < 5 || datos[0] != '3' || datos[1] != 'D' || datos[2] != 'M' || datos[3] != 'Z') {
+        return false;
+    }
+    in.p += 4;
+    if (in.byte() != VERSION) return false;
+
+    uint64_t nLeido = in.varint();
+    uint64_t mLeido = in.varint();
+    uint64_t total = in.varint();
+    uint64_t numBloques = in.varint();
+    if (!in.ok || total > maxTotal || nLeido > INT32_MAX || mLeido > INT32_MAX || 2 * nLeido * mLeido > UINT32_MAX) {
+        return false;
+    }
+    n = (int)nLeido;
+    m = (int)mLeido;
+
+    uint64_t totalGarbage = (n > 0) ? (uint64_t)m * (n - 1) : 0;
+    uint64_t dimension = tamanoDimension(n, m);
+    uint64_t emitidas = 0;
+
+    for (uint64_t b = 0; b < numBloques && in.ok; ++b) {
+        switch (in.byte()) {
+            case BLOQUE_ANILLO: {
+                uint64_t var = in.varint();
+                if (!in.ok || var < 1 || var > (uint64_t)n || total - emitidas < 2 * (uint64_t)m) return false;
+                emitirAnillo((int)var, m, emitir);
+                emitidas += 2 * (uint64_t)m;
+                break;
+            }
+            case BLOQUE_BASURA: {
+                uint64_t k = in.varint();
+                if (!in.ok || k >= totalGarbage || total - emitidas < dimension) return false;
+                emitirBasura((int)k, n, m, emitir);
+                emitidas += dimension;
+                break;
+            }
+            case BLOQUE_BASURA_ETAPA: {
+                uint64_t k = in.varint();
+                if (!in.ok || k >= totalGarbage || total - emitidas < 2 * (uint64_t)n) return false;
+                emitirBasuraEtapa((int)k, n, m, emitir);
+                emitidas += 2 * (uint64_t)n;
+                break;
+            }
+            case BLOQUE_LITERAL: {
+                uint64_t cuenta = in.varint();
+                if (total - emitidas < cuenta) return false;
+                int64_t w = 0, x = 0, y = 0;
+                for (uint64_t i = 0; i < cuenta && in.ok; ++i) {
+                    // Suma sin signo: un delta corrupto no puede desbordar
+                    w = (int64_t)((uint64_t)w + (uint64_t)in.zigzag());
+                    x = (int64_t)((uint64_t)x + (uint64_t)in.zigzag());
+                    y = (int64_t)((uint64_t)y + (uint64_t)in.zigzag());
+                    if (w < 0 || x < 0 || y < 0 ||
+                        (uint64_t)w >= dimension || (uint64_t)x >= dimension || (uint64_t)y >= dimension) {
+                        return false;
+                    }
+                    emitir(TripletaCompacta{(uint32_t)w, (uint32_t)x, (uint32_t)y});
+                }
+                emitidas += cuenta;
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return in.ok && emitidas == total && in.p == in.fin;
+}
+
+#endif // CODIFICADOR_COMPACTO_H
@@ -0,0 +1,106 @@
+/**
+ * @file ColaAcotada.h
+ * @brief Cola bloqueante de capacidad limitada para comunicar hilos
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef COLA_ACOTADA_H
+#define COLA_ACOTADA_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Cola FIFO con capacidad máxima (contrapresión)
+ *
+ * poner() bloquea mientras la cola está llena y extraer() mientras está
+ * vacía. Tras cerrar() los productores ya no pueden poner elementos y los
+ * consumidores vacían lo que quede antes de recibir false.
+ */
+template <typename T>
+class ColaAcotada {
+private:
+    std::deque<T> elementos;
+    size_t capacidad;
+    bool cerrada = false;
+    mutable std::mutex mtx;
+    std::condition_variable hayHueco;
+    std::condition_variable hayElementos;
+
+public:
+    explicit ColaAcotada(size_t cap) : capacidad(cap > 0 ? cap : 1) {}
+
+    /**
+     * @brief Añade un elemento, esperando si la cola está llena
+     * @return false si la cola se cerró
+     */
+    bool poner(T valor) {
+        std::unique_lock<std::mutex> lock(mtx);
+        hayHueco.wait(lock, [&] { return cerrada || elementos.size() < capacidad; });
+        if (cerrada) return false;
+        elementos.push_back(std::move(valor));
+        hayElementos.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Extrae un elemento, esperando si la cola está vacía
+     * @return false si la cola está cerrada y vacía
+     */
+    bool extraer(T& valor) {
+        std::unique_lock<std::mutex> lock(mtx);
+        hayElementos.wait(lock, [&] { return cerrada || !elementos.empty(); });
+        if (elementos.empty()) return false;
+        valor = std::move(elementos.front());
+        elementos.pop_front();
+        hayHueco.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Extrae de una vez todos los elementos disponibles, hasta 'maximo'
+     *
+     * Espera sólo por el primero; el resto se toma si ya está en la cola. Así
+     * un consumidor procesa en lote las peticiones pequeñas que se acumulan.
+     *
+     * @param maximo Número máximo de elementos del lote
+     * @param pesoMaximo Se deja de extraer cuando la suma de peso(e) lo alcanza
+     * @return false si la cola está cerrada y vacía
+     */
+    template <typename Peso>
+    bool extraerLote(std::vector<T>& lote, size_t maximo, size_t pesoMaximo, Peso peso) {
+        lote.clear();
+        std::unique_lock<std::mutex> lock(mtx);
+        hayElementos.wait(lock, [&] { return cerrada || !elementos.empty(); });
+        size_t acumulado = 0;
+        while (!elementos.empty() && lote.size() < maximo && (lote.empty() || acumulado < pesoMaximo)) {
+            acumulado += peso(elementos.front());
+            lote.push_back(std::move(elementos.front()));
+            elementos.pop_front();
+        }
+        hayHueco.notify_all();
+        return !lote.empty();
+    }
+
+    /**
+     * @brief Cierra la cola y despierta a todos los hilos que esperan
+     */
+    void cerrar() {
+        std::lock_guard<std::mutex> lock(mtx);
+        cerrada = true;
+        hayHueco.notify_all();
+        hayElementos.notify_all();
+    }
+
+    size_t tamano() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return elementos.size();
+    }
+};
+
+#endif // COLA_ACOTADA_H
@@ -0,0 +1,127 @@
+/**
+ * @file Deduplicacion.h
+ * @brief Detección y eliminación de tripletas repetidas mediante hashing
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef DEDUPLICACION_H
+#define DEDUPLICACION_H
+
+#include "Elementos.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Conjunto de tripletas con direccionamiento abierto (sondeo lineal)
+ *
+ * Las celdas guardan la tripleta misma (3 índices de 32 bits); una celda
+ * con w = VACIA está libre. Ningún índice válido llega a ese valor, ya que
+ * las dimensiones tienen 2·n·m < 2^32 elementos. La tabla se mantiene por
+ * debajo de la mitad de ocupación, así las búsquedas recorren pocas celdas.
+ */
+class TablaTripletas {
+private:
+    static constexpr uint32_t VACIA = UINT32_MAX;
+
+    std::vector<TripletaCompacta> celdas;
+    size_t mascara = 0;
+    size_t ocupadas = 0;
+
+    static uint64_t hash(const TripletaCompacta& t) {
+        uint64_t v = ((uint64_t)t.w << 32 | t.x) ^ ((uint64_t)t.y * 0x9e3779b97f4a7c15ull);
+        v ^= v >> 33;
+        v *= 0xff51afd7ed558ccdull;
+        v ^= v >> 33;
+        return v;
+    }
+
+    void redimensionar(size_t capacidad) {
+        std::vector<TripletaCompacta> anteriores;
+        anteriores.swap(celdas);
+        celdas.assign(capacidad, TripletaCompacta{VACIA, 0, 0});
+        mascara = capacidad - 1;
+        ocupadas = 0;
+        for (const auto& t : anteriores) {
+            if (t.w != VACIA) insertar(t);
+        }
+    }
+
+public:
+    /**
+     * @param esperadas Número de tripletas que se piensa insertar (evita crecer)
+     */
+    explicit TablaTripletas(size_t esperadas = 0) {
+        size_t capacidad = 16;
+        while (capacidad < 2 * esperadas) capacidad <<= 1;
+        redimensionar(capacidad);
+    }
+
+    /**
+     * @brief Inserta la tripleta si no estaba
+     * @return true si es nueva, false si ya estaba en la tabla
+     */
+    bool insertar(const TripletaCompacta& t) {
+        if (2 * (ocupadas + 1) > celdas.size()) {
+            redimensionar(2 * celdas.size());
+        }
+        for (size_t i = hash(t) & mascara;; i = (i + 1) & mascara) {
+            TripletaCompacta& celda = celdas[i];
+            if (celda.w == VACIA) {
+                celda = t;
+                ++ocupadas;
+                return true;
+            }
+            if (celda == t) return false;
+        }
+    }
+
+    size_t size() const { return ocupadas; }
+};
+
+/**
+ * @brief Sumidero que descarta las tripletas ya vistas y pasa el resto a otro
+ *
+ * Sirve para deduplicar durante la generación (ver NucleoReduccion.h), sin
+ * guardar primero el conjunto completo.
+ */
+template <typename Sumidero>
+struct SumideroSinDuplicados {
+    Sumidero& destino;
+    TablaTripletas vistas;
+    uint64_t eliminadas = 0;
+
+    explicit SumideroSinDuplicados(Sumidero& s) : destino(s) {}
+    void reservar(uint64_t total) {
+        vistas = TablaTripletas((size_t)total);
+        destino.reservar(total);
+    }
+    void operator()(const TripletaCompacta& t) {
+        if (vistas.insertar(t)) destino(t);
+        else ++eliminadas;
+    }
+};
+
+/**
+ * @brief Resultado de eliminarDuplicadas()
+ */
+struct ResultadoDeduplicacion {
+    uint64_t originales = 0;
+    uint64_t eliminadas = 0;
+};
+
+/**
+ * @brief Quita las tripletas repetidas, conservando la primera aparición y el orden
+ *
+ * Las tripletas se reparten entre los hilos según su hash: cada hilo recorre
+ * todo el vector en orden pero sólo inserta en su propia TablaTripletas las de
+ * su partición, de modo que no hay tablas compartidas ni bloqueos. Al final se
+ * compacta el vector en su sitio.
+ *
+ * @param tripletas Tripletas a deduplicar (se modifican)
+ * @param hilos Número de hilos (0 = los del sistema)
+ */
+ResultadoDeduplicacion eliminarDuplicadas(std::vector<TripletaCompacta>& tripletas, unsigned hilos = 0);
+
+#endif // DEDUPLICACION_H
@@ -0,0 +1,108 @@
+/**
+ * @file Elementos.h
+ * @brief Numeración compacta de los elementos W, X, Y de la reducción
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef ELEMENTOS_H
+#define ELEMENTOS_H
+
+#include "Tripleta.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Tripleta (w, x, y) con los elementos representados por su índice
+ *
+ * Cada dimensión se numera de forma independiente en el rango [0, 2·n·m):
+ * - W: tips w_v_j (2·((v-1)·m + j)) y w_neg_v_j (2·((v-1)·m + j) + 1)
+ * - X: x_v_j en [0, n·m), s1_cj en [n·m, n·m + m), g1_k en [n·m + m, 2·n·m)
+ * - Y: y_v_j, s2_cj y g2_k con la misma disposición que X
+ */
+struct TripletaCompacta {
+    uint32_t w;
+    uint32_t x;
+    uint32_t y;
+};
+
+inline bool operator==(const TripletaCompacta& a, const TripletaCompacta& b) {
+    return a.w == b.w && a.x == b.x && a.y == b.y;
+}
+
+inline bool operator!=(const TripletaCompacta& a, const TripletaCompacta& b) {
+    return !(a == b);
+}
+
+// Los índices se calculan en 32 bits sin signo: con 2·n·m <= UINT32_MAX no
+// desbordan, mientras que n·m + m + k en int sí lo haría a partir de 2^31.
+
+/**
+ * @brief Índice en W del tip de la variable var (1..n) en la etapa j (0..m-1)
+ */
+inline uint32_t idTip(int var, int etapa, bool negado, int m) {
+    return 2u * ((uint32_t)(var - 1) * (uint32_t)m + (uint32_t)etapa) + (negado ? 1u : 0u);
+}
+
+/**
+ * @brief Índice en X (o Y) del nodo interno x_v_j (o y_v_j) del anillo
+ */
+inline uint32_t idNodoAnillo(int var, int etapa, int m) {
+    return (uint32_t)(var - 1) * (uint32_t)m + (uint32_t)etapa;
+}
+
+/**
+ * @brief Índice en X (o Y) del nodo s1_cj (o s2_cj) de la cláusula j (0..m-1)
+ */
+inline uint32_t idNodoClausula(int j, int n, int m) {
+    return (uint32_t)n * (uint32_t)m + (uint32_t)j;
+}
+
+/**
+ * @brief Índice en X (o Y) del par de basura g1_k (o g2_k), con k en 0..m·(n-1)-1
+ */
+inline uint32_t idNodoBasura(int k, int n, int m) {
+    return (uint32_t)n * (uint32_t)m + (uint32_t)m + (uint32_t)k;
+}
+
+/**
+ * @brief Número de elementos de cada dimensión (|W| = |X| = |Y| = 2·n·m)
+ */
+inline uint64_t tamanoDimension(int n, int m) {
+    return 2ull * (uint64_t)n * (uint64_t)m;
+}
+
+/**
+ * @brief Tripletas de un matching perfecto: una por elemento de W (2·n·m)
+ */
+inline uint64_t tamanoMatchingPerfecto(int n, int m) {
+    return tamanoDimension(n, m);
+}
+
+/**
+ * @brief Nombre legible de un elemento de W (ej: "w_a_1", "w_neg_b_2")
+ */
+std::string nombreElementoW(uint32_t id, int n, int m);
+
+/**
+ * @brief Nombre legible de un elemento de X (ej: "x_a_1", "s1_c2", "g1_3")
+ */
+std::string nombreElementoX(uint32_t id, int n, int m);
+
+/**
+ * @brief Nombre legible de un elemento de Y (ej: "y_a_1", "s2_c2", "g2_3")
+ */
+std::string nombreElementoY(uint32_t id, int n, int m);
+
+/**
+ * @brief Deduce el tipo de una tripleta a partir de sus índices
+ * @return "Var-<v>-True", "Var-<v>-False", "Clausula-<j>" o "Garbage"
+ */
+std::string tipoTripleta(const TripletaCompacta& t, int n, int m);
+
+/**
+ * @brief Convierte una tripleta compacta en su representación con nombres
+ */
+Tripleta aTripleta(const TripletaCompacta& t, int n, int m);
+
+#endif // ELEMENTOS_H
@@ -0,0 +1,60 @@
+/**
+ * @file Exportador.h
+ * @brief Exportación de la instancia 3DM a formatos de cobertura exacta, ILP y SAT
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef EXPORTADOR_H
+#define EXPORTADOR_H
+
+#include "Reduccion3SATto3DM.h"
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Escritores del conjunto M para resolutores externos
+ *
+ * Todos trabajan sobre los índices de TripletaCompacta y los convierten a
+ * texto con std::to_chars en un búfer propio, sin construir nombres. Los
+ * elementos se llaman w<i>, x<i>, y<i> (índices de Elementos.h) y la tripleta
+ * i-ésima de M es t<i> (variable i+1 en CNF).
+ *
+ * Formatos (en todos, una solución es un matching perfecto de M):
+ * - XCC: entrada de los programas DLX de Knuth. Una línea con los 3·2nm
+ *   ítems primarios y una opción por tripleta.
+ * - LP:  formato LP de CPLEX. Una restricción "= 1" por elemento y una
+ *   variable binaria por tripleta.
+ * - MPS: el mismo modelo en MPS libre, escrito por columnas.
+ * - CNF: DIMACS. Por elemento, una cláusula "al menos una" y las de "como
+ *   mucho una" con el contador secuencial de Sinz (k-1 variables auxiliares
+ *   y 3k-4 cláusulas para k tripletas).
+ */
+class Exportador {
+public:
+    enum Formato {
+        FORMATO_XCC,
+        FORMATO_LP,
+        FORMATO_MPS,
+        FORMATO_CNF
+    };
+
+    /**
+     * @brief Reconoce el nombre de un formato ("xcc", "dlx", "lp", "mps", "cnf")
+     * @return false si no es ninguno de ellos
+     */
+    static bool formatoDesdeNombre(const std::string& nombre, Formato& formato);
+
+    /**
+     * @brief Escribe la instancia en el formato indicado
+     * @return false si hubo un error de escritura o la instancia tiene 2^32 tripletas o más
+     */
+    static bool exportar(const InstanciaVista& instancia, Formato formato, std::ostream& out);
+
+    /**
+     * @brief Igual que exportar(), en un archivo
+     */
+    static bool exportarArchivo(const InstanciaVista& instancia, Formato formato, const std::string& filepath);
+};
+
+#endif // EXPORTADOR_H
@@ -0,0 +1,113 @@
+/**
+ * @file Gadgets.h
+ * @brief Generadores de los bloques aritméticos de la reducción
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ *
+ * Los anillos de variables y los pares de basura siguen patrones fijos que
+ * dependen sólo de unos pocos parámetros. Se definen aquí una única vez para
+ * que la reducción y el codificador compacto generen exactamente las mismas
+ * tripletas.
+ */
+
+#ifndef GADGETS_H
+#define GADGETS_H
+
+#include "Elementos.h"
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Construcción de la fase de Garbage Collection
+ */
+enum VarianteBasura : uint8_t {
+    BASURA_COMPLETA = 0,  // Cada par conectado con los 2·n·m tips (construcción clásica)
+    BASURA_POR_ETAPA = 1  // Cada par conectado sólo con los 2·n tips de su etapa
+};
+
+/**
+ * @brief Entrega una tripleta al consumidor; false si éste pide detener el bloque
+ *
+ * Un consumidor que devuelve bool puede cortar la emisión devolviendo false
+ * (el codificador compacto deja de comparar en la primera diferencia); con
+ * uno que devuelve void el bloque se emite entero sin coste añadido.
+ */
+template <typename F>
+inline bool emitirTripleta(F& emitir, const TripletaCompacta& t) {
+    if constexpr (std::is_same<decltype(emitir(t)), bool>::value) {
+        return emitir(t);
+    } else {
+        emitir(t);
+        return true;
+    }
+}
+
+/**
+ * @brief Emite las 2·m tripletas del anillo de la variable var
+ *
+ * Por cada etapa j se emite primero la opción True (w_neg, x_j, y_j) y después
+ * la opción False (w_pos, x_{j+1}, y_j), cerrando el anillo con (j+1) % m.
+ *
+ * @param emitir Función invocada con cada TripletaCompacta (ver emitirTripleta)
+ */
+template <typename F>
+inline void emitirAnillo(int var, int m, F&& emitir) {
+    for (int j = 0; j < m; ++j) {
+        uint32_t x_ij = idNodoAnillo(var, j, m);
+        uint32_t y_ij = idNodoAnillo(var, j, m);
+        uint32_t x_next = idNodoAnillo(var, (j + 1) % m, m);
+        if (!emitirTripleta(emitir, TripletaCompacta{idTip(var, j, true, m), x_ij, y_ij}) ||
+            !emitirTripleta(emitir, TripletaCompacta{idTip(var, j, false, m), x_next, y_ij})) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Emite las 2·n·m tripletas del par de basura k (0-based)
+ *
+ * El par (g1_k, g2_k) se conecta con todos los tips, positivo y negativo,
+ * de todas las variables y etapas.
+ */
+template <typename F>
+inline void emitirBasura(int k, int n, int m, F&& emitir) {
+    uint32_t g = idNodoBasura(k, n, m);
+    for (int i = 1; i <= n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            if (!emitirTripleta(emitir, TripletaCompacta{idTip(i, j, false, m), g, g}) ||
+                !emitirTripleta(emitir, TripletaCompacta{idTip(i, j, true, m), g, g})) {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Emite las 2·n tripletas del par de basura k en la variante por etapas
+ *
+ * El par (g1_k, g2_k) pertenece a la etapa j = k / (n-1) y sólo se conecta con
+ * los tips de esa etapa, positivo y negativo, de todas las variables. Cada
+ * etapa tiene así n-1 pares.
+ *
+ * Por qué basta (sea cual sea la fórmula): en un matching perfecto cada anillo
+ * toma todas sus opciones True o todas False, de modo que en la etapa j queda
+ * libre exactamente un tip por variable (n en total). La cláusula j sólo puede
+ * cubrir s1_cj/s2_cj con un tip de la etapa j, que consume uno de ellos, y los
+ * n-1 restantes son justo los que recogen los n-1 pares de la etapa. Por tanto
+ * hay matching perfecto si y sólo si cada cláusula tiene un literal verdadero,
+ * igual que con emitirBasura(), pero con 2·n·m·(n-1) tripletas de basura en
+ * lugar de 2·n·m²·(n-1).
+ */
+template <typename F>
+inline void emitirBasuraEtapa(int k, int n, int m, F&& emitir) {
+    uint32_t g = idNodoBasura(k, n, m);
+    int j = k / (n - 1);
+    for (int i = 1; i <= n; ++i) {
+        if (!emitirTripleta(emitir, TripletaCompacta{idTip(i, j, false, m), g, g}) ||
+            !emitirTripleta(emitir, TripletaCompacta{idTip(i, j, true, m), g, g})) {
+            return;
+        }
+    }
+}
+
+#endif // GADGETS_H
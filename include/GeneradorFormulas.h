@@ -0,0 +1,125 @@
+/**
+ * @file GeneradorFormulas.h
+ * @brief Generación de fórmulas 3-CNF aleatorias
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef GENERADOR_FORMULAS_H
+#define GENERADOR_FORMULAS_H
+
+#include "Clausula.h"
+#include "Reduccion3SATto3DM.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Generador pseudoaleatorio xoshiro256** sembrado con splitmix64
+ *
+ * Es determinista: la misma semilla produce siempre la misma secuencia,
+ * independientemente de la plataforma o del número de hilos usados.
+ */
+class GeneradorAleatorio {
+private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    static uint64_t splitmix64(uint64_t& estado) {
+        uint64_t z = (estado += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    explicit GeneradorAleatorio(uint64_t semilla) {
+        for (auto& x : s) x = splitmix64(semilla);
+    }
+
+    uint64_t siguiente() {
+        uint64_t resultado = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return resultado;
+    }
+
+    /**
+     * @brief Entero uniforme en [0, limite) (método de Lemire, sin divisiones)
+     */
+    uint32_t uniforme(uint32_t limite) {
+        return (uint32_t)(((siguiente() >> 32) * (uint64_t)limite) >> 32);
+    }
+
+    bool moneda() { return (siguiente() >> 63) != 0; }
+};
+
+/**
+ * @brief Parámetros de generación de una fórmula 3-CNF aleatoria
+ */
+struct ParametrosGenerador {
+    int numVars = 0;          // Número de variables (al menos 3)
+    int numClausulas = 0;     // Si es 0 se usa round(ratio * numVars)
+    double ratio = 4.26;      // Cláusulas por variable (umbral de transición ~4.26)
+    bool plantada = false;    // Si se fuerza una asignación que la satisface
+    uint64_t semilla = 1;     // Semilla del generador
+};
+
+/**
+ * @brief Número de cláusulas que se generarán con los parámetros dados
+ */
+int numClausulasGeneradas(const ParametrosGenerador& p);
+
+/**
+ * @brief Genera una fórmula 3-CNF aleatoria
+ *
+ * Cada cláusula tiene tres variables distintas elegidas uniformemente y signos
+ * aleatorios. En modo plantado se fija antes una asignación oculta y se
+ * rechazan las cláusulas que no satisface, por lo que la fórmula es
+ * satisfacible.
+ *
+ * @param p Parámetros de generación
+ * @param asignacion Si no es nulo, recibe la asignación plantada (índice 1..n)
+ * @return Vector de cláusulas (vacío si los parámetros no son válidos)
+ */
+std::vector<Clausula> generarFormulaAleatoria(const ParametrosGenerador& p,
+                                              std::vector<bool>* asignacion = nullptr);
+
+/**
+ * @brief Semilla de la instancia 'indice' de un lote, derivada de la semilla base
+ *
+ * Permite generar lotes en paralelo con resultados idénticos sea cual sea el
+ * reparto de instancias entre hilos.
+ */
+uint64_t semillaInstancia(uint64_t semillaBase, uint64_t indice);
+
+/**
+ * @brief Resultado de una prueba de carga
+ */
+struct ResultadoCarga {
+    uint64_t instancias = 0;
+    uint64_t clausulas = 0;
+    uint64_t tripletas = 0;
+    double segundos = 0.0;
+};
+
+/**
+ * @brief Genera y reduce 'cantidad' instancias aleatorias en paralelo
+ *
+ * La instancia i usa la semilla semillaInstancia(p.semilla, i), de modo que el
+ * lote es reproducible.
+ *
+ * @param p Parámetros de generación (la semilla es la base del lote)
+ * @param cantidad Número de instancias
+ * @param hilos Número de hilos (0 = los del sistema)
+ * @param opciones Opciones de cada reducción
+ */
+ResultadoCarga ejecutarPruebaCarga(const ParametrosGenerador& p, uint64_t cantidad, unsigned hilos,
+                                   OpcionesReduccion opciones = OpcionesReduccion());
+
+#endif // GENERADOR_FORMULAS_H
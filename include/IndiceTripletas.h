@@ -0,0 +1,76 @@
+/**
+ * @file IndiceTripletas.h
+ * @brief Índice elemento → tripletas (CSR) para consultas por elemento
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef INDICE_TRIPLETAS_H
+#define INDICE_TRIPLETAS_H
+
+#include "Reduccion3SATto3DM.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Para cada elemento de W, X e Y, las posiciones en M de las tripletas que lo contienen
+ *
+ * Formato CSR: los 3·d elementos (d = 2·n·m) se numeran W en [0, d), X en
+ * [d, 2d) e Y en [2d, 3d); inicio[e]..inicio[e+1] delimita la lista de e
+ * dentro de un único vector de 3·|M| posiciones. Cada lista queda en el
+ * orden de M (la ordenación por conteo es estable).
+ *
+ * Se construye en paralelo: cada hilo cuenta los elementos de su tramo de M,
+ * se calculan los desplazamientos de cada hilo dentro de cada lista y cada
+ * hilo coloca su tramo sin sincronizarse con los demás.
+ *
+ * Las vistas devueltas son válidas mientras el índice exista y no se vuelva
+ * a construir.
+ */
+class IndiceTripletas {
+public:
+    enum Dimension {
+        DIMENSION_W = 0,
+        DIMENSION_X = 1,
+        DIMENSION_Y = 2
+    };
+
+    /**
+     * @brief Construye el índice de una instancia
+     * @param hilos Número de hilos (0 = los del sistema)
+     * @return false si la instancia tiene 2^32 tripletas o más, o índices fuera de rango
+     */
+    bool construir(const InstanciaVista& instancia, unsigned hilos = 0);
+
+    /**
+     * @brief Tripletas que contienen el elemento 'id' de la dimensión indicada
+     */
+    Vista<uint32_t> de(Dimension dimension, uint32_t id) const { return deGlobal(dimension * d + id); }
+    Vista<uint32_t> deW(uint32_t id) const { return deGlobal(id); }
+    Vista<uint32_t> deX(uint32_t id) const { return deGlobal(d + id); }
+    Vista<uint32_t> deY(uint32_t id) const { return deGlobal(2 * d + id); }
+
+    /**
+     * @brief Tripletas del elemento global e en [0, 3d)
+     */
+    Vista<uint32_t> deGlobal(uint64_t e) const {
+        return Vista<uint32_t>(posiciones.data() + inicio[e], (size_t)(inicio[e + 1] - inicio[e]));
+    }
+
+    /**
+     * @brief Número de elementos de cada dimensión (d = 2·n·m)
+     */
+    uint64_t tamanoDimension() const { return d; }
+
+    /**
+     * @brief Número total de elementos indexados (3·d)
+     */
+    uint64_t numElementos() const { return inicio.empty() ? 0 : inicio.size() - 1; }
+
+private:
+    uint64_t d = 0;
+    std::vector<uint64_t> inicio;
+    std::vector<uint32_t> posiciones;
+};
+
+#endif // INDICE_TRIPLETAS_H
@@ -3,8 +3,10 @@
 
 #include "Tripleta.h"
 #include "Clausula.h"
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <ostream>
 
 class JsonUtils {
 public:
@@ -13,15 +15,54 @@ public:
         int numVars;
         std::vector<Clausula> clausulas;
         bool exito;
+        std::string error; // Motivo del fallo, con la posición en el texto
     };
 
     // Lee un archivo JSON con el formato:
     // { "variables": 3, "clauses": [[1, -2, 3], ...] }
+    // Comprueba la sintaxis completa, que cada cláusula tenga exactamente tres
+    // enteros y que no haya desbordamientos; nunca lanza excepciones. Las
+    // claves desconocidas se ignoran.
     static FormulaData leerFormulaJson(const std::string& filepath);
 
+    // Igual que leerFormulaJson, pero a partir del texto ya cargado en memoria
+    static FormulaData leerFormulaJsonTexto(const std::string& content);
+
+    // Comprueba que todos los literales estén en [-numVars, numVars] y no sean 0
+    static bool literalesValidos(const FormulaData& data, std::string& error);
+
+    // Escribe una fórmula con el mismo formato que lee leerFormulaJson
+    static bool guardarFormulaJson(const std::string& filepath, int numVars, const std::vector<Clausula>& clausulas);
+
+    // Lee los índices (posiciones en M) de las tripletas de un matching con el
+    // formato [3, 17, ...] o { "matching": [3, 17, ...] }
+    static bool leerIndicesJsonTexto(const std::string& content, std::vector<uint64_t>& indices, std::string& error);
+
+    // Escribe los índices con el formato { "matching": [...] }
+    static bool guardarIndicesJson(const std::string& filepath, const std::vector<uint64_t>& indices);
+
+    // Lee una asignación con el formato:
+    // { "variables": 3, "assignment": [1, -2, 3] }
+    // El literal v pone la variable v a TRUE y -v a FALSE; las que no aparecen
+    // quedan a FALSE. 'asignacion' se indexa de 1 a numVars.
+    static bool leerAsignacionJson(const std::string& filepath, int& numVars, std::vector<bool>& asignacion,
+                                   std::string& error);
+
+    // Escribe una asignación (índices 1..n) con el formato de leerAsignacionJson
+    static bool guardarAsignacionJson(const std::string& filepath, const std::vector<bool>& asignacion);
+
     // Escribe el resultado en JSON con el formato:
     // { "triplets": [ { "w": "...", "x": "...", "y": "...", "type": "..." }, ... ] }
-    static bool guardarResultadoJson(const std::string& filepath, const std::vector<Tripleta>& tripletas, int targetMatching);
+    static bool guardarResultadoJson(const std::string& filepath, const std::vector<Tripleta>& tripletas, uint64_t targetMatching);
+
+    // Escribe el mismo JSON que guardarResultadoJson en cualquier flujo
+    static void escribirResultadoJson(std::ostream& file, const std::vector<Tripleta>& tripletas, uint64_t targetMatching);
+
+    // Piezas de escribirResultadoJson, para escribir el resultado por partes
+    // sin tener todas las tripletas en memoria a la vez
+    static void escribirCabeceraResultadoJson(std::ostream& file, uint64_t totalTripletas, uint64_t targetMatching);
+    static void escribirTripletaJson(std::ostream& file, const Tripleta& t, bool ultima);
+    static void escribirPieResultadoJson(std::ostream& file);
 };
 
 #endif // JSON_UTILS_H
@@ -0,0 +1,119 @@
+/**
+ * @file LoteReduccion.h
+ * @brief Reducción de muchas fórmulas pequeñas en una única arena compartida
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef LOTE_REDUCCION_H
+#define LOTE_REDUCCION_H
+
+#include "Clausula.h"
+#include "GeneradorFormulas.h"
+#include "Gadgets.h"
+#include "Reduccion3SATto3DM.h"
+#include "Vista.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Lote de fórmulas y sus instancias 3DM en memoria contigua
+ *
+ * Las cláusulas de todas las fórmulas van seguidas en un solo vector y las
+ * tripletas de todas las instancias en una sola arena; dos tablas de
+ * desplazamientos (N+1 entradas cada una) delimitan la parte de cada
+ * instancia. Como el número de tripletas de cada instancia se conoce de
+ * antemano (numTripletas), reducir() reserva la arena de una vez y cada hilo
+ * escribe sus instancias directamente en su sitio, sin objetos por instancia
+ * ni crecimiento de vectores.
+ *
+ * Formato de archivo (.3dml, enteros en little-endian en cualquier máquina):
+ *   "3DML" version variante instancias:u64 clausulas:u64 tripletas:u64
+ *   variables:i32[N] inicioClausulas:u64[N+1] clausulas:(i32 i32 i32)[C]
+ *   inicioTripletas:u64[N+1] tripletas:(u32 u32 u32)[T]
+ */
+class LoteReduccion {
+public:
+    static const uint8_t VERSION = 1;
+
+    explicit LoteReduccion(VarianteBasura basura = BASURA_COMPLETA);
+
+    /**
+     * @brief Reserva espacio para 'instancias' fórmulas con 'clausulas' cláusulas en total
+     */
+    void reservar(size_t instancias, size_t clausulas);
+
+    /**
+     * @brief Añade una fórmula al lote (invalida las tripletas ya reducidas)
+     * @return false si n o m no son positivos, 2·n·m no cabe en 32 bits o
+     *         algún literal es 0 o está fuera de [-n, n]; no se añade nada
+     */
+    bool agregar(int n, Vista<Clausula> formula);
+
+    /**
+     * @brief Reduce todas las fórmulas del lote en paralelo
+     * @param hilos Número de hilos (0 = los del sistema)
+     * @return Total de tripletas
+     */
+    uint64_t reducir(unsigned hilos = 0);
+
+    size_t size() const { return variables.size(); }
+    VarianteBasura getVarianteBasura() const { return basura; }
+    uint64_t totalClausulas() const { return clausulas.size(); }
+    uint64_t totalTripletas() const { return reducidas ? inicioTripletas.back() : 0; }
+
+    int numVariables(size_t i) const { return variables[i]; }
+    int numClausulas(size_t i) const { return (int)(inicioClausulas[i + 1] - inicioClausulas[i]); }
+    Vista<Clausula> formula(size_t i) const {
+        return Vista<Clausula>(clausulas.data() + inicioClausulas[i], (size_t)numClausulas(i));
+    }
+
+    /**
+     * @brief Tripletas de la instancia i (vacío si aún no se ha reducido)
+     */
+    Vista<TripletaCompacta> tripletas(size_t i) const {
+        if (!reducidas) return Vista<TripletaCompacta>();
+        return Vista<TripletaCompacta>(arena.get() + inicioTripletas[i],
+                                       (size_t)(inicioTripletas[i + 1] - inicioTripletas[i]));
+    }
+    InstanciaVista instancia(size_t i) const { return InstanciaVista{numVariables(i), numClausulas(i), tripletas(i)}; }
+
+    /**
+     * @brief Guarda el lote reducido en un único archivo .3dml
+     */
+    bool guardarArchivo(const std::string& filepath) const;
+
+    /**
+     * @brief Carga un lote guardado con guardarArchivo
+     * @return false si el archivo no existe, está truncado o es incoherente:
+     *         desplazamientos fuera de las tablas, instancias que no cumplen
+     *         agregar(), tamaños distintos de numTripletas o elementos fuera
+     *         de [0, 2·n·m)
+     */
+    bool leerArchivo(const std::string& filepath);
+
+private:
+    VarianteBasura basura;
+    std::vector<int> variables;
+    std::vector<uint64_t> inicioClausulas{0};
+    std::vector<Clausula> clausulas;
+    std::vector<uint64_t> inicioTripletas{0};
+    std::unique_ptr<TripletaCompacta[]> arena; // Sin inicializar: cada hilo toca sólo lo suyo
+    bool reducidas = false;
+
+    // Instancia válida para agregar(): n, m > 0, 2·n·m en 32 bits y literales en rango
+    static bool instanciaValida(int n, Vista<Clausula> formula, VarianteBasura basura);
+
+    // Cada instancia válida, con exactamente numTripletas(n, m) tripletas y todas en rango
+    bool coherente() const;
+};
+
+/**
+ * @brief Como ejecutarPruebaCarga, pero reduciendo todas las instancias en un LoteReduccion
+ */
+ResultadoCarga ejecutarPruebaCargaLote(const ParametrosGenerador& p, uint64_t cantidad, unsigned hilos,
+                                       VarianteBasura basura = BASURA_COMPLETA);
+
+#endif // LOTE_REDUCCION_H
@@ -0,0 +1,272 @@
+/**
+ * @file NucleoReduccion.h
+ * @brief Núcleo de la reducción parametrizado por sumidero y codificación
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ *
+ * La reducción se escribe una sola vez como plantilla: cada consumidor elige
+ * dónde van las tripletas (Sumidero) y cómo se representan sus elementos
+ * (Codificacion), y el compilador genera un bucle específico sin llamadas
+ * virtuales ni formato de cadenas cuando no se necesitan.
+ *
+ * Un Sumidero es cualquier tipo con:
+ *   void reservar(uint64_t total);               // pista de tamaño (puede no hacer nada)
+ *   void operator()(const Codificacion::Tripleta&);
+ *
+ * Una Codificacion se construye con (n, m) y convierte cada TripletaCompacta
+ * en su tipo Tripleta mediante operator().
+ */
+
+#ifndef NUCLEO_REDUCCION_H
+#define NUCLEO_REDUCCION_H
+
+#include "Clausula.h"
+#include "Elementos.h"
+#include "Gadgets.h"
+#include "Vista.h"
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Tamaños de la instancia (evaluables en tiempo de compilación)
+// ---------------------------------------------------------------------------
+
+constexpr uint64_t numTripletasAnillos(uint64_t n, uint64_t m) { return 2 * n * m; }
+constexpr uint64_t numTripletasClausulas(uint64_t m) { return 3 * m; }
+constexpr uint64_t numParesBasura(uint64_t n, uint64_t m) { return n > 0 ? m * (n - 1) : 0; }
+constexpr uint64_t numTripletasBasura(uint64_t n, uint64_t m, VarianteBasura variante = BASURA_COMPLETA) {
+    return numParesBasura(n, m) * 2 * n * (variante == BASURA_POR_ETAPA ? 1 : m);
+}
+
+/**
+ * @brief Total de tripletas de M: 2nm + 3m + 2·n·m²·(n-1)
+ *
+ * Con BASURA_POR_ETAPA la basura aporta 2·n·m·(n-1) en lugar de 2·n·m²·(n-1).
+ */
+constexpr uint64_t numTripletas(uint64_t n, uint64_t m, VarianteBasura variante = BASURA_COMPLETA) {
+    return numTripletasAnillos(n, m) + numTripletasClausulas(m) + numTripletasBasura(n, m, variante);
+}
+
+/**
+ * @brief Límite de tripletas de M por defecto en la línea de comandos y el pipeline
+ *
+ * 2^28 tripletas ocupan 3 GB como TripletaCompacta.
+ */
+constexpr uint64_t LIMITE_TRIPLETAS = 1ull << 28;
+
+/**
+ * @brief Comprueba, antes de reservar nada, que la instancia se pueda reducir
+ *
+ * Los índices de los elementos deben caber en 32 bits (2·n·m <= UINT32_MAX)
+ * y, si maxTripletas no es 0, M no puede tener más tripletas. Con 2·n·m en 32
+ * bits numTripletas() no desborda.
+ *
+ * @param error Recibe el motivo si la instancia no es abarcable
+ */
+inline bool instanciaAbarcable(int n, int m, VarianteBasura variante, uint64_t maxTripletas, std::string& error) {
+    if (n <= 0 || m <= 0) {
+        error = "la fórmula necesita variables y cláusulas";
+        return false;
+    }
+    if (tamanoDimension(n, m) > UINT32_MAX) {
+        error = "instancia demasiado grande: 2·n·m = " + std::to_string(tamanoDimension(n, m)) +
+                " elementos por dimensión no caben en 32 bits";
+        return false;
+    }
+    uint64_t tripletas = numTripletas(n, m, variante);
+    if (maxTripletas > 0 && tripletas > maxTripletas) {
+        error = "instancia demasiado grande: " + std::to_string(tripletas) + " tripletas (el límite es " +
+                std::to_string(maxTripletas) + ")";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Tamaños de una instancia con N variables y M cláusulas fijos
+ */
+template <uint64_t N, uint64_t M>
+struct TamanoInstancia {
+    static constexpr uint64_t elementosPorDimension = 2 * N * M;
+    static constexpr uint64_t tripletas = numTripletas(N, M);
+};
+
+static_assert(TamanoInstancia<3, 2>::tripletas == 66, "data/ejemplo_json.json genera 66 tripletas");
+static_assert(numTripletas(3, 2, BASURA_POR_ETAPA) == 42, "con basura por etapas: 12 + 6 + 4·6");
+
+// ---------------------------------------------------------------------------
+// Codificaciones de los elementos
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Índices por dimensión, tal como en Elementos.h (no hace nada)
+ */
+struct CodificacionLocal {
+    using Tripleta = TripletaCompacta;
+    CodificacionLocal(int, int) {}
+    const TripletaCompacta& operator()(const TripletaCompacta& t) const { return t; }
+};
+
+/**
+ * @brief Índices globales: W en [0, d), X en [d, 2d), Y en [2d, 3d), con d = 2nm
+ *
+ * Es la numeración natural para formatos de cobertura exacta, donde los tres
+ * conjuntos forman un único universo de elementos.
+ */
+struct CodificacionGlobal {
+    using Tripleta = TripletaCompacta;
+    uint32_t d;
+    CodificacionGlobal(int n, int m) : d((uint32_t)tamanoDimension(n, m)) {}
+    TripletaCompacta operator()(const TripletaCompacta& t) const { return {t.w, t.x + d, t.y + 2 * d}; }
+};
+
+/**
+ * @brief Nombres legibles ("w_a_1", "x_a_2"...), como getTripletas()
+ */
+struct CodificacionNombres {
+    using Tripleta = ::Tripleta;
+    int n, m;
+    CodificacionNombres(int numVars, int numClausulas) : n(numVars), m(numClausulas) {}
+    ::Tripleta operator()(const TripletaCompacta& t) const { return aTripleta(t, n, m); }
+};
+
+// ---------------------------------------------------------------------------
+// Sumideros
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Añade las tripletas a un vector
+ */
+template <typename T>
+struct SumideroVector {
+    std::vector<T>& destino;
+    explicit SumideroVector(std::vector<T>& v) : destino(v) {}
+    void reservar(uint64_t total) { destino.reserve(destino.size() + total); }
+    void operator()(const T& t) { destino.push_back(t); }
+};
+
+/**
+ * @brief Escribe las tripletas seguidas desde un puntero (el espacio ya está reservado)
+ */
+struct SumideroPuntero {
+    TripletaCompacta* p;
+    void reservar(uint64_t) {}
+    void operator()(const TripletaCompacta& t) { *p++ = t; }
+};
+
+/**
+ * @brief Sólo cuenta las tripletas
+ */
+struct SumideroContador {
+    uint64_t total = 0;
+    void reservar(uint64_t) {}
+    template <typename T>
+    void operator()(const T&) { ++total; }
+};
+
+/**
+ * @brief Huella de 64 bits del flujo de tripletas (depende del orden)
+ *
+ * Dos instancias con la misma huella son, con altísima probabilidad, el mismo
+ * flujo; sirve para comprobaciones rápidas sin guardar las tripletas.
+ */
+struct SumideroHash {
+    uint64_t huella = 0x84222325cbf29ce4ull;
+    uint64_t total = 0;
+    void reservar(uint64_t) {}
+    void operator()(const TripletaCompacta& t) {
+        uint64_t v = ((uint64_t)t.w << 32 | t.x) ^ ((uint64_t)t.y * 0x9e3779b97f4a7c15ull);
+        v ^= v >> 33;
+        v *= 0xff51afd7ed558ccdull;
+        v ^= v >> 33;
+        huella = (huella ^ v) * 0x100000001b3ull;
+        ++total;
+    }
+};
+
+/**
+ * @brief Pasa cada tripleta a una función (escritura en flujo, filtros...)
+ */
+template <typename F>
+struct SumideroFuncion {
+    F f;
+    explicit SumideroFuncion(F funcion) : f(funcion) {}
+    void reservar(uint64_t) {}
+    template <typename T>
+    void operator()(const T& t) { f(t); }
+};
+
+// ---------------------------------------------------------------------------
+// Fases de la reducción
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Truth-Setting: un anillo de m etapas por variable
+ */
+template <typename F>
+inline void emitirComponentesVariables(int n, int m, F&& emitir) {
+    for (int i = 1; i <= n; ++i) {
+        emitirAnillo(i, m, emitir);
+    }
+}
+
+/**
+ * @brief Satisfaction Testing: (tip del literal, s1_cj, s2_cj) por cada literal de la cláusula j
+ *
+ * Si la variable se puso a TRUE en el anillo, el tip positivo está LIBRE.
+ */
+template <typename F>
+inline void emitirComponentesClausulas(int n, Vista<Clausula> formula, F&& emitir) {
+    int m = (int)formula.size();
+    for (int j = 0; j < m; ++j) {
+        const Clausula& c = formula[j];
+        uint32_t c_s1 = idNodoClausula(j, n, m);
+        uint32_t c_s2 = idNodoClausula(j, n, m);
+        for (int literal : {c.l1, c.l2, c.l3}) {
+            emitir(TripletaCompacta{idTip(std::abs(literal), j, literal < 0, m), c_s1, c_s2});
+        }
+    }
+}
+
+/**
+ * @brief Garbage Collection: m·(n-1) pares conectados con todos los tips
+ *
+ * Con BASURA_POR_ETAPA cada par se conecta sólo con los tips de su etapa
+ * (ver emitirBasuraEtapa() en Gadgets.h).
+ */
+template <typename F>
+inline void emitirGarbageCollection(int n, int m, F&& emitir, VarianteBasura variante = BASURA_COMPLETA) {
+    int totalGarbage = (int)numParesBasura(n, m);
+    for (int k = 0; k < totalGarbage; ++k) {
+        if (variante == BASURA_POR_ETAPA) emitirBasuraEtapa(k, n, m, emitir);
+        else emitirBasura(k, n, m, emitir);
+    }
+}
+
+/**
+ * @brief Reducción completa de 3SAT a 3DM hacia un sumidero
+ *
+ * Ejemplos:
+ *   SumideroContador c;  reducirNucleo(n, formula, c);           // sólo contar
+ *   SumideroHash h;      reducirNucleo(n, formula, h);           // sólo la huella
+ *   std::vector<TripletaCompacta> v;
+ *   SumideroVector<TripletaCompacta> s(v);
+ *   reducirNucleo<CodificacionGlobal>(n, formula, s);            // índices globales
+ */
+template <typename Codificacion = CodificacionLocal, typename Sumidero>
+inline void reducirNucleo(int n, Vista<Clausula> formula, Sumidero& sumidero,
+                          VarianteBasura variante = BASURA_COMPLETA) {
+    int m = (int)formula.size();
+    Codificacion codificacion(n, m);
+    auto emitir = [&](const TripletaCompacta& t) { sumidero(codificacion(t)); };
+
+    sumidero.reservar(numTripletas(n, m, variante));
+    emitirComponentesVariables(n, m, emitir);
+    emitirComponentesClausulas(n, formula, emitir);
+    emitirGarbageCollection(n, m, emitir, variante);
+}
+
+#endif // NUCLEO_REDUCCION_H
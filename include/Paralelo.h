@@ -0,0 +1,42 @@
+/**
+ * @file Paralelo.h
+ * @brief Reparto sencillo de trabajo entre hilos
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Número de hilos para repartir 'total' elementos
+ *
+ * Con 0 se usan los del sistema; nunca se dan menos de 'tramoMinimo'
+ * elementos por hilo, porque lanzar hilos para poco trabajo sale más caro.
+ */
+inline unsigned hilosPara(uint64_t total, unsigned hilos, uint64_t tramoMinimo = 1 << 16) {
+    if (hilos == 0) hilos = std::max(1u, std::thread::hardware_concurrency());
+    return (unsigned)std::max<uint64_t>(1, std::min<uint64_t>(hilos, total / tramoMinimo));
+}
+
+/**
+ * @brief Ejecuta trabajo(h) para h en [0, hilos), el 0 en el hilo actual
+ */
+template <typename F>
+void enParalelo(unsigned hilos, F&& trabajo) {
+    std::vector<std::thread> todos;
+    for (unsigned h = 1; h < hilos; ++h) {
+        todos.emplace_back(trabajo, h);
+    }
+    trabajo(0u);
+    for (auto& t : todos) {
+        t.join();
+    }
+}
+
+#endif // PARALELO_H
@@ -0,0 +1,71 @@
+/**
+ * @file Pipeline.h
+ * @brief Procesamiento por lotes en tres etapas: lectura → reducción → escritura
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "NucleoReduccion.h"
+#include "Reduccion3SATto3DM.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Configuración del pipeline
+ */
+struct ConfiguracionPipeline {
+    std::string dirSalida = "out";  // Directorio donde se escriben los resultados
+    bool compacto = false;          // .3dmz (CodificadorCompacto) en lugar de .json
+    OpcionesReduccion opciones;     // Opciones de cada reducción
+    unsigned lectores = 2;          // Hilos de lectura
+    unsigned reductores = 0;        // Hilos de reducción (0 = los del sistema)
+    unsigned escritores = 2;        // Hilos de escritura
+    size_t capacidadCola = 8;       // Instancias en espera entre dos etapas
+    uint64_t maxTripletas = LIMITE_TRIPLETAS; // Las fórmulas con M mayor se rechazan al leerlas (0 = sin límite)
+};
+
+/**
+ * @brief Contadores de una etapa del pipeline
+ */
+struct EstadisticasEtapa {
+    uint64_t elementos = 0;         // Instancias que salieron de la etapa
+    uint64_t bytes = 0;             // Bytes leídos (lectura) o generados (reducción, escritura)
+    double segundosOcupada = 0.0;   // Tiempo de trabajo, sumado entre los hilos de la etapa
+    double segundosBloqueada = 0.0; // Tiempo esperando hueco en la cola siguiente (contrapresión)
+};
+
+/**
+ * @brief Resultado de una ejecución del pipeline
+ */
+struct ResultadoPipeline {
+    uint64_t correctos = 0;
+    std::vector<std::string> errores;   // Un mensaje por archivo fallido
+    double segundos = 0.0;
+    EstadisticasEtapa lectura;
+    EstadisticasEtapa reduccion;
+    EstadisticasEtapa escritura;
+};
+
+/**
+ * @brief Reduce una lista de archivos de fórmulas solapando E/S y cálculo
+ *
+ * Cada etapa tiene sus propios hilos y se comunica con la siguiente mediante
+ * una ColaAcotada: mientras se reduce una instancia se puede estar leyendo la
+ * siguiente y escribiendo la anterior. Si una etapa es más lenta, las colas se
+ * llenan y las etapas anteriores esperan, de modo que la memoria usada queda
+ * limitada por capacidadCola.
+ *
+ * La serialización (JSON o compacta) se hace en la etapa de reducción, así la
+ * etapa de escritura sólo hace E/S.
+ *
+ * @param archivos Rutas de las fórmulas (formato JSON de data/)
+ * @param config Configuración del pipeline
+ */
+ResultadoPipeline ejecutarPipeline(const std::vector<std::string>& archivos, const ConfiguracionPipeline& config);
+
+#endif // PIPELINE_H
@@ -0,0 +1,116 @@
+/**
+ * @file Recuperacion.h
+ * @brief Reducción inversa: de un matching de M a una asignación de la fórmula
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef RECUPERACION_H
+#define RECUPERACION_H
+
+#include "Clausula.h"
+#include "Elementos.h"
+#include "Gadgets.h"
+#include "Vista.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief De dónde sale la tripleta que ocupa una posición de M
+ *
+ * El campo valor es el valor de la variable que la tripleta exige: en un
+ * anillo, el que asigna su opción (True o False); en una cláusula o en la
+ * basura, aquel con el que su tip queda libre (TRUE para el tip positivo).
+ */
+struct OrigenTripleta {
+    enum Tipo {
+        ANILLO,
+        CLAUSULA,
+        BASURA,
+        FUERA_DE_RANGO
+    };
+
+    Tipo tipo = FUERA_DE_RANGO;
+    int variable = 0;          // 1..n: variable del tip en W
+    int etapa = 0;             // 0..m-1 (en una cláusula, la cláusula)
+    bool valor = false;
+    TripletaCompacta tripleta{0, 0, 0};
+};
+
+/**
+ * @brief Tripleta en la posición p de M, sin generar M
+ *
+ * La reducción emite M en un orden fijo (2·n·m tripletas de anillos, 3·m de
+ * cláusulas y la basura por pares), así que la posición basta para saber el
+ * tipo, la variable, la etapa y los índices en O(1). Sólo vale para M tal
+ * como lo genera la reducción, sin eliminar duplicadas.
+ */
+OrigenTripleta origenTripleta(int n, Vista<Clausula> formula, uint64_t posicion,
+                              VarianteBasura basura = BASURA_COMPLETA);
+
+/**
+ * @brief Resultado de recuperar una asignación a partir de un matching
+ */
+struct ResultadoRecuperacion {
+    std::vector<bool> asignacion;         // Índices 1..n
+    uint64_t tripletas = 0;               // Tamaño del matching
+    uint64_t fueraDeRango = 0;            // Posiciones que no están en M
+    uint64_t solapadas = 0;               // Tripletas que repiten algún elemento ya cubierto
+    uint64_t sinCubrir = 0;               // Elementos de W, X e Y sin cubrir
+    uint64_t variablesIncoherentes = 0;   // Anillos sin todas sus etapas con la misma opción
+    uint64_t clausulasFalsas = 0;         // Cláusulas que la asignación no satisface
+    int primeraClausulaFalsa = 0;         // 1..m (0 si no hay)
+    double segundos = 0.0;
+
+    bool matchingPerfecto() const { return fueraDeRango == 0 && solapadas == 0 && sinCubrir == 0; }
+    bool valida() const { return matchingPerfecto() && variablesIncoherentes == 0 && clausulasFalsas == 0; }
+};
+
+/**
+ * @brief Recupera la asignación de la fórmula codificada en un matching de M
+ *
+ * Cada posición se clasifica con origenTripleta, sin tabla ni nombres: el
+ * recorrido es O(|matching|) más O(n·m) para comprobar que se cubren todos
+ * los elementos una sola vez. La variable v toma el valor de la opción
+ * elegida en su anillo (el de la primera etapa cubierta si el anillo es
+ * incoherente). Después se comprueban las cláusulas contra la asignación,
+ * repartidas entre hilos.
+ *
+ * @param hilos Número de hilos para las cláusulas (0 = los del sistema)
+ * @return Sin asignación si la instancia no cabe en índices de 32 bits
+ */
+ResultadoRecuperacion recuperarAsignacion(int n, Vista<Clausula> formula, Vista<uint64_t> matching,
+                                          VarianteBasura basura = BASURA_COMPLETA, unsigned hilos = 0);
+
+/**
+ * @brief Matching perfecto de M construido a partir de una asignación (la ida de la prueba)
+ *
+ * Los anillos toman la opción de cada variable, cada cláusula el primer
+ * literal cierto y los pares de basura los tips que quedan libres.
+ *
+ * @param asignacion Índices 1..n
+ * @return Posiciones en M, vacío si la asignación no satisface la fórmula
+ *         (o si la instancia no cabe en índices de 32 bits)
+ */
+std::vector<uint64_t> construirMatching(int n, Vista<Clausula> formula, const std::vector<bool>& asignacion,
+                                        VarianteBasura basura = BASURA_COMPLETA);
+
+/**
+ * @brief Lee un matching de memoria: binario (.3dmm) o lista JSON de posiciones
+ *
+ * Formato binario (enteros en little-endian en cualquier máquina):
+ *   "3DMM" version:u8 cuenta:u64 posiciones:u64[cuenta]
+ * Si no empieza por "3DMM" se lee como JSON ([3, 17, ...] o
+ * { "matching": [...] }).
+ */
+bool decodificarMatching(const std::vector<uint8_t>& datos, std::vector<uint64_t>& matching, std::string& error);
+
+bool leerMatching(const std::string& filepath, std::vector<uint64_t>& matching, std::string& error);
+
+/**
+ * @brief Guarda un matching en binario, o en JSON si la ruta acaba en .json
+ */
+bool guardarMatching(const std::string& filepath, const std::vector<uint64_t>& matching);
+
+#endif // RECUPERACION_H
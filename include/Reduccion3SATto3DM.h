@@ -3,10 +3,35 @@
 
 #include "Tripleta.h"
 #include "Clausula.h"
+#include "AlmacenTripletas.h"
+#include "Elementos.h"
+#include "Gadgets.h"
+#include "Vista.h"
 #include <vector>
-#include <map>
 #include <string>
 
+/**
+ * @brief Vista sin copias de una instancia 3DM ya generada
+ *
+ * Apunta a las tripletas internas de la reducción: es válida mientras el
+ * objeto Reduccion3SATto3DM exista y no se vuelva a llamar a generar().
+ */
+struct InstanciaVista {
+    int n; // Número de variables
+    int m; // Número de cláusulas
+    Vista<TripletaCompacta> tripletas;
+};
+
+/**
+ * @brief Opciones de generación de la reducción
+ */
+struct OpcionesReduccion {
+    bool eliminarDuplicadas = false; // Descarta las tripletas repetidas (ver Deduplicacion.h)
+    VarianteBasura basura = BASURA_COMPLETA; // Construcción del Garbage Collection (ver Gadgets.h)
+    uint64_t presupuestoMemoria = 0; // Bytes para tripletas antes de volcar a disco (0 = sin límite)
+    std::string dirTemporal;         // Directorio de los volcados ("" = $TMPDIR o /tmp)
+};
+
 /**
  * @brief Clase que implementa la reducción de 3SAT a 3DM
  * 
@@ -17,18 +42,40 @@
  * 1. Truth-Setting: Componentes para cada variable que fuerzan elegir True o False
  * 2. Satisfaction Testing: Tripletas que verifican si las cláusulas se satisfacen
  * 3. Garbage Collection: Elementos adicionales para completar el matching perfecto
+ *
+ * La clase no es dueña de la fórmula: guarda una Vista a las cláusulas del
+ * llamador, que deben seguir existiendo (y sin modificarse) hasta que
+ * termine generar(). Las tripletas generadas sí son propias.
  */
 class Reduccion3SATto3DM {
 private:
     int n; // Número de variables
     int m; // Número de cláusulas
-    std::vector<Clausula> formula; // Fórmula 3SAT de entrada
-    std::vector<Tripleta> M;       // Conjunto M de tripletas resultante
+    Vista<Clausula> formula;       // Fórmula 3SAT de entrada (no se copia)
+    OpcionesReduccion opciones;
+    uint64_t duplicadasEliminadas = 0;
     
-    // Almacenamos los "tips" (puntas) de W generados por las variables
-    // map[variable_id][clausula_index] -> nombre_del_nodo_w
-    std::map<int, std::vector<std::string>> tipsPositivos;
-    std::map<int, std::vector<std::string>> tipsNegativos;
+    // Conjunto M con los elementos numerados (ver Elementos.h). Es la
+    // representación que se genera; M se construye a partir de ella.
+    // Los "tips" de W se obtienen con idTip(variable, etapa, negado, m).
+    std::vector<TripletaCompacta> MCompacta;
+
+    // Destino de las tripletas con presupuestoMemoria > 0. Si al terminar
+    // nada se volcó a disco, sus tripletas pasan a MCompacta.
+    AlmacenTripletas almacen;
+
+    // Conjunto M con nombres legibles. Se construye la primera vez que se
+    // pide (getTripletas, imprimirResultados), ya que cuesta mucho más que
+    // la propia reducción y la mayoría de usos no lo necesitan.
+    mutable std::vector<Tripleta> M;
+
+    /**
+     * @brief Llama a fase(sumidero) con el destino de las tripletas
+     *
+     * El destino es MCompacta, o el almacén con presupuesto si se pidió.
+     */
+    template <typename Fase>
+    void conDestino(Fase&& fase);
 
     /**
      * @brief Genera los componentes de variables (Truth-Setting)
@@ -49,40 +96,134 @@ private:
     /**
      * @brief Genera los componentes de basura (Garbage Collection)
      * 
-     * Añade tripletas adicionales para asegurar que el matching perfecto
-     * tenga la cardinalidad correcta (m * n tripletas).
+     * Añade m·(n-1) pares de basura que recogen los tips que no usan las
+     * cláusulas, para que el matching perfecto cubra los 2·n·m elementos de
+     * cada dimensión. Con BASURA_COMPLETA cada par se conecta con los 2·n·m
+     * tips (2·n·m²·(n-1) tripletas); con BASURA_POR_ETAPA sólo con los 2·n
+     * tips de su etapa (2·n·m·(n-1) tripletas).
      */
     void generarGarbageCollection();
 
 public:
     /**
      * @brief Constructor de la clase
+     * 
+     * La fórmula no se copia: las cláusulas apuntadas por f deben seguir
+     * existiendo hasta que termine generar(). Un std::vector se convierte
+     * implícitamente en la vista; no debe destruirse ni redimensionarse antes.
+     * 
      * @param numVars Número de variables en la fórmula 3SAT
-     * @param f Vector de cláusulas que conforman la fórmula 3SAT
+     * @param f Vista a las cláusulas de la fórmula 3SAT (prestadas, no se copian)
+     * @param ops Opciones de generación
      */
-    Reduccion3SATto3DM(int numVars, std::vector<Clausula> f);
+    Reduccion3SATto3DM(int numVars, Vista<Clausula> f, OpcionesReduccion ops = OpcionesReduccion());
+
+    /**
+     * @brief Prohibido: la fórmula se toma prestada, no se adopta
+     *
+     * Un vector temporal se destruiría al terminar la expresión, antes de
+     * generar(), y la vista quedaría colgando. Hay que guardar el vector en
+     * una variable que viva al menos hasta después de generar().
+     */
+    Reduccion3SATto3DM(int numVars, std::vector<Clausula>&& f, OpcionesReduccion ops = OpcionesReduccion()) = delete;
 
     /**
      * @brief Ejecuta la reducción completa
      * 
      * Genera todos los componentes (variables, cláusulas y basura)
-     * necesarios para la reducción de 3SAT a 3DM.
+     * necesarios para la reducción de 3SAT a 3DM. No escribe en consola.
      */
     void generar();
 
+    /**
+     * @brief Tripletas que imprimirResultados muestra como máximo
+     */
+    static const uint64_t LIMITE_DETALLE = 1000;
+
     /**
      * @brief Imprime los resultados de la reducción
      * 
-     * Muestra todas las tripletas generadas y estadísticas sobre
-     * el conjunto M resultante.
+     * Muestra las primeras LIMITE_DETALLE tripletas generadas y estadísticas
+     * sobre el conjunto M resultante. Para instancias mayores, ver Visor.
      */
     void imprimirResultados() const;
 
     /**
-     * @brief Obtiene el conjunto de tripletas generado
+     * @brief Obtiene el conjunto de tripletas generado, con nombres legibles
+     * 
+     * Los nombres se construyen en la primera llamada. No es seguro llamarlo
+     * a la vez desde varios hilos sobre el mismo objeto.
+     * 
      * @return Vector de tripletas
      */
-    const std::vector<Tripleta>& getTripletas() const { return M; }
+    const std::vector<Tripleta>& getTripletas() const;
+
+    /**
+     * @brief Obtiene el conjunto de tripletas con los elementos numerados
+     *
+     * Si la reducción se volcó a disco (ver presupuestoMemoria y enDisco())
+     * el vector está vacío: hay que usar recorrerBloques().
+     *
+     * @return Vector de tripletas compactas, en el mismo orden que getTripletas()
+     */
+    const std::vector<TripletaCompacta>& getTripletasCompactas() const { return MCompacta; }
+
+    /**
+     * @brief Recorre las tripletas compactas por bloques, estén en memoria o en disco
+     * @param f Función invocada con cada Vista<TripletaCompacta>, en orden
+     * @return false si no se pudo leer un volcado
+     */
+    template <typename F>
+    bool recorrerBloques(F&& f) const {
+        if (almacen.enDisco()) return almacen.recorrerBloques(f);
+        f(Vista<TripletaCompacta>(MCompacta));
+        return true;
+    }
+
+    /**
+     * @brief Número de tripletas de M, estén en memoria o en disco
+     */
+    uint64_t getNumTripletas() const { return almacen.enDisco() ? almacen.size() : MCompacta.size(); }
+
+    /**
+     * @brief Indica si las tripletas se volcaron a disco por el presupuesto de memoria
+     */
+    bool enDisco() const { return almacen.enDisco(); }
+
+    /**
+     * @brief Bytes de tripletas escritos en el temporal
+     */
+    uint64_t getBytesEnDisco() const { return almacen.bytesEnDisco(); }
+
+    /**
+     * @brief false si falló la escritura de algún volcado (disco lleno...)
+     */
+    bool ok() const { return almacen.ok(); }
+
+    /**
+     * @brief Vista de la instancia generada, sin copias ni nombres
+     */
+    InstanciaVista getInstancia() const { return {n, m, Vista<TripletaCompacta>(MCompacta)}; }
+
+    /**
+     * @brief Tripletas repetidas que se descartaron (sólo con eliminarDuplicadas)
+     */
+    uint64_t getDuplicadasEliminadas() const { return duplicadasEliminadas; }
+
+    /**
+     * @brief Número de variables de la fórmula
+     */
+    int getNumVariables() const { return n; }
+
+    /**
+     * @brief Número de cláusulas de la fórmula
+     */
+    int getNumClausulas() const { return m; }
+
+    /**
+     * @brief Construcción usada en la fase de Garbage Collection
+     */
+    VarianteBasura getVarianteBasura() const { return opciones.basura; }
 };
 
 #endif // REDUCCION3SATTO3DM_H
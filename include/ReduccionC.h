@@ -0,0 +1,66 @@
+/**
+ * @file ReduccionC.h
+ * @brief Interfaz C (ABI estable) de la reducción 3SAT → 3DM
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ *
+ * Pensada para usar la biblioteca desde otros lenguajes o servicios. No
+ * escribe en consola ni lanza excepciones: todos los errores se devuelven
+ * como códigos r3dm_estado.
+ */
+
+#ifndef REDUCCION_C_H
+#define REDUCCION_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Instancia 3DM generada (opaca) */
+typedef struct r3dm_instancia r3dm_instancia;
+
+/** Tripleta con los elementos numerados como en Elementos.h */
+typedef struct {
+    uint32_t w;
+    uint32_t x;
+    uint32_t y;
+} r3dm_tripleta;
+
+typedef enum {
+    R3DM_OK = 0,
+    R3DM_ERROR_ARGUMENTO = 1,   /* Puntero nulo, sin variables o sin cláusulas */
+    R3DM_ERROR_LITERAL = 2,     /* Literal 0 o fuera de [-num_vars, num_vars] */
+    R3DM_ERROR_MEMORIA = 3,     /* No hay memoria para la instancia */
+    R3DM_ERROR_TAMANO = 4       /* 2·n·m no cabe en 32 bits o M supera LIMITE_TRIPLETAS (NucleoReduccion.h) */
+} r3dm_estado;
+
+/**
+ * @brief Ejecuta la reducción
+ * @param num_vars Número de variables
+ * @param literales 3 * num_clausulas literales, cláusula a cláusula (no se copian)
+ * @param num_clausulas Número de cláusulas
+ * @param salida Recibe la instancia; se libera con r3dm_liberar
+ */
+r3dm_estado r3dm_reducir(int num_vars, const int* literales, size_t num_clausulas,
+                         r3dm_instancia** salida);
+
+/** Número de tripletas de la instancia */
+size_t r3dm_num_tripletas(const r3dm_instancia* instancia);
+
+/** Tripletas de la instancia; válidas hasta r3dm_liberar */
+const r3dm_tripleta* r3dm_tripletas(const r3dm_instancia* instancia);
+
+/** Número de elementos de cada dimensión (|W| = |X| = |Y|) */
+uint64_t r3dm_tamano_dimension(const r3dm_instancia* instancia);
+
+/** Libera una instancia (admite NULL) */
+void r3dm_liberar(r3dm_instancia* instancia);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REDUCCION_C_H */
@@ -0,0 +1,70 @@
+/**
+ * @file Servicio.h
+ * @brief Servicio de reducción de larga duración sobre un socket Unix
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ *
+ * Protocolo (enteros little-endian). Cada conexión puede enviar varias
+ * peticiones seguidas sin esperar respuesta; las respuestas llevan el mismo
+ * identificador que la petición y pueden llegar en otro orden.
+ *
+ *   Petición:  u32 longitud | u32 id | u8 formato | fórmula JSON
+ *   Respuesta: u32 longitud | u32 id | u8 estado  | carga
+ *
+ * 'longitud' cuenta los bytes que siguen al propio campo. El formato es
+ * FORMATO_JSON (carga = resultado JSON, como guardarResultadoJson) o
+ * FORMATO_COMPACTO (carga = codificación de CodificadorCompacto). Si el
+ * estado es ESTADO_ERROR la carga es un mensaje de texto.
+ */
+
+#ifndef SERVICIO_H
+#define SERVICIO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+const uint8_t FORMATO_JSON = 'J';
+const uint8_t FORMATO_COMPACTO = 'B';
+
+const uint8_t ESTADO_OK = 0;
+const uint8_t ESTADO_ERROR = 1;
+
+/**
+ * @brief Configuración del servicio
+ */
+struct ConfiguracionServicio {
+    std::string rutaSocket;        // Ruta del socket Unix
+    unsigned hilos = 0;            // Hilos de reducción (0 = los del sistema)
+    size_t tamanoLote = 64;        // Máximo de peticiones por lote
+    size_t bytesLote = 64u << 10;  // Un lote se cierra al sumar estos bytes de fórmulas
+    size_t capacidadCola = 4096;   // Peticiones pendientes antes de aplicar contrapresión
+    size_t tamanoMaximoPeticion = 64u << 20; // Bytes; las mayores se rechazan
+    uint64_t maxTripletas = 1ull << 22;      // Tripletas de M por petición; las fórmulas mayores se rechazan
+};
+
+/**
+ * @brief Ejecuta el servicio hasta recibir SIGINT o SIGTERM
+ *
+ * Las conexiones se leen en hilos propios; las peticiones se encolan y un
+ * conjunto fijo de hilos las reduce en lotes, de modo que muchas peticiones
+ * pequeñas comparten una sola espera en la cola.
+ *
+ * @return Código de salida del proceso
+ */
+int ejecutarServicio(const ConfiguracionServicio& config);
+
+/**
+ * @brief Cliente sencillo: envía 'repeticiones' veces la misma fórmula y espera cada respuesta
+ * @param rutaSocket Ruta del socket del servicio
+ * @param formulaJson Texto de la fórmula (mismo formato que los archivos de data/)
+ * @param formato FORMATO_JSON o FORMATO_COMPACTO
+ * @param repeticiones Número de peticiones (secuenciales)
+ * @param respuesta Recibe la carga de la última respuesta
+ * @param segundosPorPeticion Recibe la latencia media de ida y vuelta
+ * @return true si todas las respuestas tuvieron ESTADO_OK
+ */
+bool enviarPeticiones(const std::string& rutaSocket, const std::string& formulaJson, uint8_t formato,
+                      unsigned repeticiones, std::string& respuesta, double& segundosPorPeticion);
+
+#endif // SERVICIO_H
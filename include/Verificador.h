@@ -0,0 +1,99 @@
+/**
+ * @file Verificador.h
+ * @brief Pruebas diferenciales de la reducción y arnés de fuzzing de los lectores
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef VERIFICADOR_H
+#define VERIFICADOR_H
+
+#include "Clausula.h"
+#include "Reduccion3SATto3DM.h"
+#include "Vista.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Parámetros de una verificación con fórmulas aleatorias pequeñas
+ */
+struct OpcionesVerificacion {
+    uint64_t casos = 1000;   // Número de fórmulas a probar
+    uint64_t semilla = 1;    // Semilla base (el caso i usa semillaInstancia(semilla, i))
+    int maxVariables = 4;    // n en [1, maxVariables]
+    int maxClausulas = 5;    // m en [1, maxClausulas]
+    unsigned hilos = 0;      // 0 = los del sistema
+};
+
+/**
+ * @brief Resultado de una verificación
+ */
+struct ResultadoVerificacion {
+    uint64_t casos = 0;
+    uint64_t satisfacibles = 0;
+    uint64_t fallos = 0;
+    std::vector<std::string> discrepancias; // Las primeras, con la semilla de cada caso
+    double segundos = 0.0;
+};
+
+/**
+ * @brief Satisfacibilidad por fuerza bruta (2^n asignaciones, n <= 24)
+ * @param asignacion Si no es nulo y hay solución, recibe una (índice 1..n)
+ */
+bool satisfacibleFuerzaBruta(int n, Vista<Clausula> formula, std::vector<bool>* asignacion = nullptr);
+
+/**
+ * @brief Existencia de un matching perfecto por búsqueda exhaustiva
+ *
+ * Cobertura exacta con retroceso: en cada paso se cubre el elemento con menos
+ * tripletas disponibles. Exponencial en el peor caso; pensado para instancias
+ * de unas pocas decenas de elementos por dimensión.
+ *
+ * @param matching Si no es nulo y hay matching, recibe sus posiciones en M
+ */
+bool tieneMatchingPerfecto(const InstanciaVista& instancia, std::vector<uint64_t>* matching = nullptr);
+
+/**
+ * @brief Compara la reducción de una fórmula con la fuerza bruta
+ *
+ * Para las dos variantes de basura, con y sin eliminación de duplicadas,
+ * comprueba el número de tripletas, que todos los índices estén en rango y
+ * todos los elementos se usen, la ida y vuelta por CodificadorCompacto y que
+ * haya matching perfecto exactamente cuando la fórmula es satisfacible. Sin
+ * eliminar duplicadas, además, el matching encontrado debe dar una asignación
+ * que satisface la fórmula y el construido desde la fuerza bruta debe
+ * devolver la misma asignación (Recuperacion.h).
+ *
+ * @param discrepancia Recibe la primera diferencia encontrada
+ * @return true si todo coincide
+ */
+bool verificarFormula(int n, const std::vector<Clausula>& formula, std::string& discrepancia);
+
+/**
+ * @brief Verifica en paralelo 'casos' fórmulas aleatorias pequeñas
+ *
+ * Los literales se eligen sin restricciones, así que aparecen cláusulas con
+ * literales repetidos o complementarios. Cada caso es reproducible con su
+ * semilla.
+ */
+ResultadoVerificacion verificarAleatorias(const OpcionesVerificacion& opciones);
+
+/**
+ * @brief Arnés de fuzzing: procesa una entrada arbitraria y aborta si algo no cuadra
+ *
+ * Si empieza por "3DMZ" se decodifica como instancia compacta (y se comprueba
+ * la ida y vuelta); si empieza por "3DMM", como matching binario; si no, se lee como fórmula JSON y, si es válida y pequeña,
+ * se pasa por verificarFormula. Nunca debe lanzar excepciones ni fallar una
+ * comprobación interna: si lo hace, llama a abort() para que el fuzzer lo
+ * registre.
+ *
+ * Compatible con libFuzzer (LLVMFuzzerTestOneInput en src/FuzzEntrada.cpp) y
+ * con AFL a través de la orden --probar-entrada.
+ *
+ * @return Siempre 0
+ */
+int probarEntrada(const uint8_t* datos, size_t tam);
+
+#endif // VERIFICADOR_H
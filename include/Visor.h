@@ -0,0 +1,124 @@
+/**
+ * @file Visor.h
+ * @brief Visor paginado y filtrado del conjunto M a partir de la representación compacta
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef VISOR_H
+#define VISOR_H
+
+#include "Gadgets.h"
+#include "IndiceTripletas.h"
+#include "Reduccion3SATto3DM.h"
+#include <cstdint>
+#include <iostream>
+#include <map>
+
+/**
+ * @brief Tamaños de una instancia calculados sólo con n, m y la variante de basura
+ */
+struct ResumenInstancia {
+    int n = 0;
+    int m = 0;
+    VarianteBasura basura = BASURA_COMPLETA;
+    uint64_t elementosPorDimension = 0; // |W| = |X| = |Y| = 2·n·m
+    uint64_t tripletasAnillo = 0;
+    uint64_t tripletasClausula = 0;
+    uint64_t tripletasBasura = 0;
+    uint64_t tripletas = 0;
+    uint64_t matching = 0;              // Tripletas de un matching perfecto
+    uint64_t bytesCompactos = 0;        // Memoria de M como TripletaCompacta
+};
+
+/**
+ * @brief Resumen en O(1), sin generar la instancia
+ */
+ResumenInstancia resumenInstancia(int n, int m, VarianteBasura basura = BASURA_COMPLETA);
+
+void mostrarResumen(std::ostream& out, const ResumenInstancia& r);
+
+/**
+ * @brief Qué tripletas muestra el visor (los criterios se combinan con Y)
+ */
+struct FiltroVisor {
+    enum Tipo {
+        TODAS,
+        ANILLO,
+        CLAUSULA,
+        BASURA
+    };
+
+    Tipo tipo = TODAS;
+    int variable = 0;      // 1..n: tripletas que usan un tip de la variable (0 = cualquiera)
+    int clausula = 0;      // 1..m: tripletas de la cláusula (0 = cualquiera)
+    int dimension = -1;    // Elemento contenido: IndiceTripletas::Dimension (-1 = sin filtro)
+    uint32_t elemento = 0;
+};
+
+/**
+ * @brief Muestra porciones de M, formateando sólo las tripletas visibles
+ *
+ * Si M está en el orden en que lo genera la reducción (anillos, cláusulas y
+ * basura; se reconoce por su tamaño), los filtros por tipo, cláusula y
+ * variable del anillo se traducen directamente a rangos de posiciones. El
+ * filtro por elemento usa un IndiceTripletas, que se construye sólo si se
+ * pide. El resto se comprueba tripleta a tripleta sobre los índices
+ * compactos, recordando dónde empieza cada página ya vista para que
+ * avanzar o retroceder no vuelva a recorrer desde el principio.
+ *
+ * La instancia debe seguir viva mientras se use el visor.
+ */
+class Visor {
+public:
+    explicit Visor(const InstanciaVista& instancia, const FiltroVisor& filtro = FiltroVisor());
+
+    /**
+     * @brief Escribe las coincidencias [desde, desde + cuantas)
+     * @return Número de tripletas escritas (menos de 'cuantas' al final)
+     */
+    size_t mostrar(std::ostream& out, uint64_t desde, size_t cuantas);
+
+    /**
+     * @brief Total de coincidencias (recorre las candidatas si hace falta)
+     */
+    uint64_t contar();
+
+    /**
+     * @brief Paginación interactiva: Enter avanza, 'p' retrocede, un número salta a esa página, 'q' sale
+     */
+    void paginar(std::istream& in, std::ostream& out, size_t porPagina);
+
+    /**
+     * @brief Variante de basura deducida del tamaño de M (si está en el orden de la reducción)
+     */
+    bool estructurada() const { return ordenReduccion; }
+    VarianteBasura getVarianteBasura() const { return basura; }
+
+    /**
+     * @brief Comprueba el filtro sobre una tripleta, sólo con sus índices
+     */
+    bool coincide(const TripletaCompacta& t) const;
+
+private:
+    InstanciaVista instancia;
+    FiltroVisor filtro;
+    bool ordenReduccion = false;
+    VarianteBasura basura = BASURA_COMPLETA;
+
+    // Candidatas: posiciones [inicio, fin) de M, o la lista de un elemento
+    uint64_t inicio = 0;
+    uint64_t fin = 0;
+    IndiceTripletas indice;
+    Vista<uint32_t> listaElemento;
+    bool porElemento = false;
+    bool todasCoinciden = false;    // El rango ya recoge el filtro completo
+
+    std::map<uint64_t, uint64_t> marcas; // Coincidencia k → candidata donde está
+    uint64_t total = UINT64_MAX;         // Coincidencias, cuando se conoce
+
+    uint64_t numCandidatas() const { return porElemento ? listaElemento.size() : fin - inicio; }
+    uint64_t candidata(uint64_t c) const { return porElemento ? listaElemento[c] : inicio + c; }
+};
+
+#endif // VISOR_H
@@ -0,0 +1,45 @@
+/**
+ * @file Vista.h
+ * @brief Vista de sólo lectura sobre un bloque contiguo de elementos
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#ifndef VISTA_H
+#define VISTA_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Puntero + longitud sobre datos que no son propiedad de la vista
+ *
+ * Equivalente a std::span<const T> (el proyecto compila en C++17). Quien crea
+ * la vista debe garantizar que los datos siguen vivos mientras se use.
+ */
+template <typename T>
+class Vista {
+private:
+    const T* datos_;
+    size_t tam_;
+
+public:
+    Vista() : datos_(nullptr), tam_(0) {}
+    Vista(const T* datos, size_t tam) : datos_(datos), tam_(tam) {}
+    Vista(const std::vector<T>& v) : datos_(v.data()), tam_(v.size()) {}
+
+    const T* data() const { return datos_; }
+    size_t size() const { return tam_; }
+    bool empty() const { return tam_ == 0; }
+
+    const T& operator[](size_t i) const { return datos_[i]; }
+    const T* begin() const { return datos_; }
+    const T* end() const { return datos_ + tam_; }
+
+    /**
+     * @brief Subvista de 'cuenta' elementos a partir de 'inicio'
+     */
+    Vista subvista(size_t inicio, size_t cuenta) const { return Vista(datos_ + inicio, cuenta); }
+};
+
+#endif // VISTA_H
@@ -0,0 +1,89 @@
+/**
+ * @file PruebaReduccionC.c
+ * @brief Prueba de la interfaz C: se compila como C y se enlaza con lib3sat3dm
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ *
+ * Comprueba una reducción correcta (tamaños e índices en rango) y cada código
+ * de error de r3dm_reducir. Devuelve 0 si todo es correcto.
+ */
+
+#include "ReduccionC.h"
+#include <limits.h>
+#include <stdio.h>
+
+static int fallos = 0;
+
+static void comprobar(int condicion, const char* descripcion) {
+    if (!condicion) {
+        fprintf(stderr, "❌ %s\n", descripcion);
+        ++fallos;
+    }
+}
+
+/* Reduce una fórmula de 2 cláusulas con el literal 'l' en la primera posición */
+static r3dm_estado reducirConLiteral(int numVars, int l) {
+    int literales[] = {l, -2, -3, -1, -2, 3};
+    r3dm_instancia* inst = NULL;
+    r3dm_estado estado = r3dm_reducir(numVars, literales, 2, &inst);
+    r3dm_liberar(inst);
+    return estado;
+}
+
+/* 100 cláusulas (1, 2, 3): con n = 200 caben en 32 bits pero M supera el límite */
+static int muchos[300];
+
+int main(void) {
+    int i;
+    for (i = 0; i < 300; ++i) muchos[i] = i % 3 + 1;
+
+    /* data/ejemplo_json.json: n = 3, m = 2, 66 tripletas, 12 elementos por dimensión */
+    int literales[] = {1, -2, -3, -1, -2, 3};
+    r3dm_instancia* inst = NULL;
+    comprobar(r3dm_reducir(3, literales, 2, &inst) == R3DM_OK, "la reducción de ejemplo debe dar R3DM_OK");
+    if (inst) {
+        const r3dm_tripleta* t = r3dm_tripletas(inst);
+        size_t total = r3dm_num_tripletas(inst);
+        uint64_t d = r3dm_tamano_dimension(inst);
+        size_t i, fuera = 0;
+        comprobar(total == 66, "la instancia de ejemplo debe tener 66 tripletas");
+        comprobar(d == 12, "cada dimensión debe tener 2·n·m = 12 elementos");
+        for (i = 0; i < total; ++i) {
+            fuera += t[i].w >= d || t[i].x >= d || t[i].y >= d;
+        }
+        comprobar(fuera == 0, "todos los índices deben estar en [0, 2·n·m)");
+    }
+    r3dm_liberar(inst);
+
+    /* Argumentos inválidos */
+    comprobar(r3dm_reducir(3, literales, 2, NULL) == R3DM_ERROR_ARGUMENTO, "salida nula");
+    comprobar(r3dm_reducir(3, NULL, 2, &inst) == R3DM_ERROR_ARGUMENTO, "literales nulos");
+    comprobar(r3dm_reducir(0, literales, 2, &inst) == R3DM_ERROR_ARGUMENTO, "sin variables");
+    comprobar(r3dm_reducir(-3, literales, 2, &inst) == R3DM_ERROR_ARGUMENTO, "variables negativas");
+    comprobar(r3dm_reducir(3, literales, 0, &inst) == R3DM_ERROR_ARGUMENTO, "sin cláusulas");
+
+    /* Literales fuera de [-n, n] o nulos, incluidos los extremos de int */
+    comprobar(reducirConLiteral(3, 0) == R3DM_ERROR_LITERAL, "literal 0");
+    comprobar(reducirConLiteral(3, 4) == R3DM_ERROR_LITERAL, "literal n + 1");
+    comprobar(reducirConLiteral(3, -4) == R3DM_ERROR_LITERAL, "literal -(n + 1)");
+    comprobar(reducirConLiteral(3, INT_MAX) == R3DM_ERROR_LITERAL, "literal INT_MAX");
+    comprobar(reducirConLiteral(3, INT_MIN) == R3DM_ERROR_LITERAL, "literal INT_MIN");
+    comprobar(reducirConLiteral(3, -3) == R3DM_OK, "literal -n");
+
+    /* 2·n·m no cabe en 32 bits, o M tendría más de LIMITE_TRIPLETAS tripletas */
+    comprobar(reducirConLiteral(INT_MAX, 1) == R3DM_ERROR_TAMANO, "2·n·m mayor que UINT32_MAX");
+    comprobar(r3dm_reducir(1, literales, (size_t)-1, &inst) == R3DM_ERROR_TAMANO, "número de cláusulas enorme");
+    comprobar(r3dm_reducir(200, muchos, 100, &inst) == R3DM_ERROR_TAMANO, "2·n·m²·(n-1) tripletas de basura");
+
+    /* Consultas sobre NULL */
+    comprobar(r3dm_num_tripletas(NULL) == 0 && r3dm_tripletas(NULL) == NULL && r3dm_tamano_dimension(NULL) == 0,
+              "las consultas sobre NULL devuelven 0");
+    r3dm_liberar(NULL);
+
+    if (fallos > 0) {
+        fprintf(stderr, "❌ Interfaz C: %d comprobaciones fallidas\n", fallos);
+        return 1;
+    }
+    printf("✓ Interfaz C: reducción y códigos de error correctos\n");
+    return 0;
+}
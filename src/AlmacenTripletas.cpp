@@ -0,0 +1,106 @@
+/**
+ * @file AlmacenTripletas.cpp
+ * @brief Implementación del almacén de tripletas con volcado a disco
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "AlmacenTripletas.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+// Bloque mínimo, para no hacer escrituras diminutas con presupuestos muy bajos
+constexpr size_t BLOQUE_MINIMO = 4096;
+
+bool escribirTodo(int fd, const void* buffer, size_t n) {
+    const char* p = static_cast<const char*>(buffer);
+    while (n > 0) {
+        ssize_t escritos = write(fd, p, n);
+        if (escritos < 0 && errno == EINTR) continue;
+        if (escritos <= 0) return false;
+        p += escritos;
+        n -= (size_t)escritos;
+    }
+    return true;
+}
+
+} // namespace
+
+AlmacenTripletas::AlmacenTripletas(uint64_t presupuestoBytes, const std::string& dir)
+    : presupuesto(presupuestoBytes), dirTemporal(dir) {
+    // La mitad para el bloque que se llena y la otra mitad para el que se lee
+    capacidadBloque = presupuesto == 0
+        ? SIZE_MAX
+        : std::max<size_t>(BLOQUE_MINIMO, (size_t)(presupuesto / 2 / sizeof(TripletaCompacta)));
+    if (dirTemporal.empty()) {
+        const char* tmp = std::getenv("TMPDIR");
+        dirTemporal = (tmp && *tmp) ? tmp : "/tmp";
+    }
+}
+
+AlmacenTripletas::~AlmacenTripletas() {
+    if (fd >= 0) close(fd);
+}
+
+void AlmacenTripletas::reservar(uint64_t total) {
+    memoria.reserve((size_t)std::min<uint64_t>(total, capacidadBloque));
+}
+
+void AlmacenTripletas::limpiar() {
+    memoria.clear();
+    bloques.clear();
+    volcadas = 0;
+    fallo = false;
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+}
+
+bool AlmacenTripletas::extraerMemoria(std::vector<TripletaCompacta>& destino) {
+    if (enDisco()) return false;
+    destino.swap(memoria);
+    memoria.clear();
+    return true;
+}
+
+void AlmacenTripletas::volcar() {
+    if (memoria.empty()) return;
+
+    if (fd < 0 && !fallo) {
+        std::string plantilla = dirTemporal + "/3sat3dm-XXXXXX";
+        fd = mkstemp(&plantilla[0]);
+        if (fd >= 0) unlink(plantilla.c_str());
+        else fallo = true;
+    }
+    if (fd >= 0 && !fallo) {
+        fallo = !escribirTodo(fd, memoria.data(), memoria.size() * sizeof(TripletaCompacta));
+    }
+
+    // Aunque falle, las tripletas se cuentan como volcadas: el error se ve en ok()
+    bloques.push_back(memoria.size());
+    volcadas += memoria.size();
+    memoria.clear();
+}
+
+bool AlmacenTripletas::leerBloque(uint64_t desde, uint64_t cuenta, std::vector<TripletaCompacta>& buffer) const {
+    if (fallo || fd < 0) return false;
+    buffer.resize((size_t)cuenta);
+    char* p = reinterpret_cast<char*>(buffer.data());
+    size_t n = (size_t)cuenta * sizeof(TripletaCompacta);
+    off_t posicion = (off_t)(desde * sizeof(TripletaCompacta));
+    while (n > 0) {
+        ssize_t leidos = pread(fd, p, n, posicion);
+        if (leidos < 0 && errno == EINTR) continue;
+        if (leidos <= 0) return false;
+        p += leidos;
+        n -= (size_t)leidos;
+        posicion += leidos;
+    }
+    return true;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file Analisis.cpp
+ * @brief Implementación del análisis de instancias 3DM
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Analisis.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Contadores locales de un hilo
+struct Parcial {
+    std::vector<uint32_t> gradoW, gradoX, gradoY;
+    uint64_t anillo = 0, clausula = 0, basura = 0, fueraDeRango = 0;
+    std::vector<std::vector<uint64_t>> cubetas; // Claves empaquetadas, una cubeta por hilo según el hash
+};
+
+// Bits por índice al empaquetar (w, x, y) en una clave de 64 bits
+constexpr unsigned BITS_INDICE = 21;
+
+uint64_t empaquetar(const TripletaCompacta& t) {
+    return (uint64_t)t.w << (2 * BITS_INDICE) | (uint64_t)t.x << BITS_INDICE | t.y;
+}
+
+unsigned cubetaDe(uint64_t clave, unsigned cubetas) {
+    clave ^= clave >> 33;
+    clave *= 0xff51afd7ed558ccdull;
+    clave ^= clave >> 33;
+    return (unsigned)(clave % cubetas);
+}
+
+// Duplicadas sin empaquetar, para dimensiones de más de 2^21 elementos
+uint64_t contarDuplicadasSinEmpaquetar(const Vista<TripletaCompacta>& tripletas, uint64_t d) {
+    std::vector<TripletaCompacta> copia;
+    for (const auto& t : tripletas) {
+        if (t.w < d && t.x < d && t.y < d) copia.push_back(t);
+    }
+    auto menor = [](const TripletaCompacta& a, const TripletaCompacta& b) {
+        return std::tie(a.w, a.x, a.y) < std::tie(b.w, b.x, b.y);
+    };
+    std::sort(copia.begin(), copia.end(), menor);
+    uint64_t duplicadas = 0;
+    for (size_t i = 1; i < copia.size(); ++i) {
+        if (copia[i] == copia[i - 1]) ++duplicadas;
+    }
+    return duplicadas;
+}
+
+EstadisticasDimension resumirGrados(const std::vector<uint32_t>& grados) {
+    EstadisticasDimension e;
+    e.elementos = grados.size();
+    if (grados.empty()) return e;
+
+    uint64_t suma = 0;
+    e.gradoMinimo = grados[0];
+    for (uint32_t g : grados) {
+        ++e.histograma[g];
+        suma += g;
+        if (g > 0) ++e.usados;
+        e.gradoMinimo = std::min<uint64_t>(e.gradoMinimo, g);
+        e.gradoMaximo = std::max<uint64_t>(e.gradoMaximo, g);
+    }
+    e.gradoMedio = (double)suma / grados.size();
+    return e;
+}
+
+} // namespace
+
+EstadisticasInstancia analizarInstancia(const InstanciaVista& instancia, unsigned hilos) {
+    const Vista<TripletaCompacta>& tripletas = instancia.tripletas;
+    const uint64_t total = tripletas.size();
+    const uint64_t d = tamanoDimension(instancia.n, instancia.m);
+    const uint64_t finAnillos = (uint64_t)instancia.n * instancia.m;
+    const uint64_t finClausulas = finAnillos + instancia.m;
+
+    hilos = hilosPara(total, hilos);
+    const bool empaquetable = d <= (1u << BITS_INDICE);
+
+    // Pasada única: grados, tipos y reparto por hash para buscar duplicadas
+    std::vector<Parcial> parciales(hilos);
+    enParalelo(hilos, [&](unsigned h) {
+        Parcial& p = parciales[h];
+        p.gradoW.assign(d, 0);
+        p.gradoX.assign(d, 0);
+        p.gradoY.assign(d, 0);
+        p.cubetas.resize(hilos);
+
+        uint64_t desde = total * h / hilos;
+        uint64_t hasta = total * (h + 1) / hilos;
+        for (uint64_t i = desde; i < hasta; ++i) {
+            const TripletaCompacta& t = tripletas[i];
+            if (t.w >= d || t.x >= d || t.y >= d) {
+                ++p.fueraDeRango;
+                continue;
+            }
+            ++p.gradoW[t.w];
+            ++p.gradoX[t.x];
+            ++p.gradoY[t.y];
+            if (t.x < finAnillos) ++p.anillo;
+            else if (t.x < finClausulas) ++p.clausula;
+            else ++p.basura;
+            if (empaquetable) {
+                uint64_t clave = empaquetar(t);
+                p.cubetas[cubetaDe(clave, hilos)].push_back(clave);
+            }
+        }
+    });
+
+    // Suma de grados por rangos de elementos y duplicadas por cubeta
+    std::vector<uint64_t> duplicadas(hilos, 0);
+    enParalelo(hilos, [&](unsigned h) {
+        uint64_t desde = d * h / hilos;
+        uint64_t hasta = d * (h + 1) / hilos;
+        for (unsigned otro = 1; otro < hilos; ++otro) {
+            for (uint64_t e = desde; e < hasta; ++e) {
+                parciales[0].gradoW[e] += parciales[otro].gradoW[e];
+                parciales[0].gradoX[e] += parciales[otro].gradoX[e];
+                parciales[0].gradoY[e] += parciales[otro].gradoY[e];
+            }
+        }
+
+        std::vector<uint64_t> cubeta;
+        for (auto& p : parciales) {
+            cubeta.insert(cubeta.end(), p.cubetas[h].begin(), p.cubetas[h].end());
+            std::vector<uint64_t>().swap(p.cubetas[h]);
+        }
+        std::sort(cubeta.begin(), cubeta.end());
+        for (size_t i = 1; i < cubeta.size(); ++i) {
+            if (cubeta[i] == cubeta[i - 1]) ++duplicadas[h];
+        }
+    });
+
+    EstadisticasInstancia e;
+    e.n = instancia.n;
+    e.m = instancia.m;
+    e.tripletas = total;
+    for (unsigned h = 0; h < hilos; ++h) {
+        e.tripletasAnillo += parciales[h].anillo;
+        e.tripletasClausula += parciales[h].clausula;
+        e.tripletasBasura += parciales[h].basura;
+        e.fueraDeRango += parciales[h].fueraDeRango;
+        e.duplicadas += duplicadas[h];
+    }
+    if (!empaquetable) {
+        e.duplicadas = contarDuplicadasSinEmpaquetar(tripletas, d);
+    }
+    e.w = resumirGrados(parciales[0].gradoW);
+    e.x = resumirGrados(parciales[0].gradoX);
+    e.y = resumirGrados(parciales[0].gradoY);
+    return e;
+}
@@ -0,0 +1,953 @@
+/**
+ * @file CLI.cpp
+ * @brief Implementación del modo no interactivo
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "CLI.h"
+#include "Reduccion3SATto3DM.h"
+#include "CodificadorCompacto.h"
+#include "JsonUtils.h"
+#include "GeneradorFormulas.h"
+#include "Servicio.h"
+#include "Pipeline.h"
+#include "NucleoReduccion.h"
+#include "Analisis.h"
+#include "Deduplicacion.h"
+#include "Exportador.h"
+#include "IndiceTripletas.h"
+#include "Verificador.h"
+#include "LoteReduccion.h"
+#include "Visor.h"
+#include "Recuperacion.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+// Indica si aparece la opción (ej: --plantada) entre los argumentos
+bool tieneOpcion(const std::vector<std::string>& args, const std::string& opcion) {
+    for (const auto& a : args) {
+        if (a == opcion) return true;
+    }
+    return false;
+}
+
+// Valor que sigue a la opción (ej: --semilla 42), o el valor por defecto
+std::string valorOpcion(const std::vector<std::string>& args, const std::string& opcion,
+                        const std::string& porDefecto) {
+    for (size_t i = 0; i + 1 < args.size(); ++i) {
+        if (args[i] == opcion) return args[i + 1];
+    }
+    return porDefecto;
+}
+
+// Argumentos que no son opciones ni valores de opciones (a partir de 'desde')
+std::vector<std::string> argumentosPosicionales(const std::vector<std::string>& args, size_t desde,
+                                                const std::vector<std::string>& opcionesConValor) {
+    std::vector<std::string> posicionales;
+    for (size_t i = desde; i < args.size(); ++i) {
+        if (args[i].rfind("--", 0) == 0) {
+            for (const auto& o : opcionesConValor) {
+                if (args[i] == o) ++i;
+            }
+            continue;
+        }
+        posicionales.push_back(args[i]);
+    }
+    return posicionales;
+}
+
+// Convierte 'texto' en un número del tipo de 'valor', sin restos (un negativo no es un sin signo)
+template <typename T>
+bool convertirNumero(const std::string& texto, T& valor) {
+    const char* fin = texto.data() + texto.size();
+    auto r = std::from_chars(texto.data(), fin, valor);
+    return !texto.empty() && r.ec == std::errc() && r.ptr == fin;
+}
+
+// Argumento numérico obligatorio; explica el error si no es un número válido
+template <typename T>
+bool leerNumero(const std::string& texto, const std::string& nombre, T& valor) {
+    if (convertirNumero(texto, valor)) return true;
+    std::cerr << "❌ Valor numérico inválido para " << nombre << ": '" << texto << "'\n";
+    return false;
+}
+
+// Opción numérica (ej: --hilos 4); si no aparece, 'valor' conserva su valor por defecto
+template <typename T>
+bool leerOpcionNumerica(const std::vector<std::string>& args, const std::string& opcion, T& valor) {
+    if (!tieneOpcion(args, opcion)) return true;
+    return leerNumero(valorOpcion(args, opcion, ""), opcion, valor);
+}
+
+// Lee los parámetros comunes del generador: <variables> <ratio> [--semilla S] [--plantada]
+bool leerParametrosGenerador(const std::vector<std::string>& args, ParametrosGenerador& p) {
+    if (!leerNumero(args[1], "<variables>", p.numVars) || !leerNumero(args[2], "<ratio>", p.ratio) ||
+        !leerOpcionNumerica(args, "--semilla", p.semilla)) {
+        return false;
+    }
+    p.plantada = tieneOpcion(args, "--plantada");
+
+    // ratio·n debe caber en int antes de redondearlo a un número de cláusulas
+    if (p.numVars < 3 || !(p.ratio * p.numVars < INT32_MAX) || numClausulasGeneradas(p) <= 0) {
+        std::cerr << "❌ Se necesitan al menos 3 variables y entre 1 y 2^31 - 1 cláusulas.\n";
+        return false;
+    }
+    return true;
+}
+
+// Lee las opciones de la reducción: [--sin-duplicados] [--basura completa|etapa]
+bool leerOpcionesReduccion(const std::vector<std::string>& args, OpcionesReduccion& opciones) {
+    opciones.eliminarDuplicadas = tieneOpcion(args, "--sin-duplicados");
+    std::string basura = valorOpcion(args, "--basura", "completa");
+    if (basura == "completa") {
+        opciones.basura = BASURA_COMPLETA;
+    } else if (basura == "etapa") {
+        opciones.basura = BASURA_POR_ETAPA;
+    } else {
+        std::cerr << "❌ Variante de basura desconocida: " << basura << " (completa|etapa)\n";
+        return false;
+    }
+    return true;
+}
+
+// Lee una fórmula JSON y comprueba sus literales y que los índices de M quepan
+// en 32 bits, explicando el error si lo hay
+bool leerFormula(const std::string& entrada, JsonUtils::FormulaData& data) {
+    data = JsonUtils::leerFormulaJson(entrada);
+    std::string error = data.error;
+    int m = (int)std::min<size_t>(data.clausulas.size(), INT32_MAX);
+    if (!data.exito || !JsonUtils::literalesValidos(data, error) ||
+        !instanciaAbarcable(data.numVars, m, BASURA_COMPLETA, 0, error)) {
+        std::cerr << "❌ Error al cargar el archivo: " << entrada << "\n";
+        std::cerr << "   " << error << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Límite de tripletas de M: --max-tripletas T (0 = sin límite)
+bool leerLimiteTripletas(const std::vector<std::string>& args, uint64_t& limite) {
+    limite = LIMITE_TRIPLETAS;
+    return leerOpcionNumerica(args, "--max-tripletas", limite);
+}
+
+// Antes de generar M: no debe superar el límite de tripletas
+bool comprobarTamanoM(int n, int m, const std::vector<std::string>& args, VarianteBasura basura) {
+    uint64_t limite;
+    if (!leerLimiteTripletas(args, limite)) return false;
+    std::string error;
+    if (instanciaAbarcable(n, m, basura, limite, error)) return true;
+    std::cerr << "❌ No se genera M: " << error << " (ver --max-tripletas)\n";
+    return false;
+}
+
+bool comprobarTamanoM(const JsonUtils::FormulaData& data, const std::vector<std::string>& args,
+                      VarianteBasura basura) {
+    return comprobarTamanoM(data.numVars, (int)data.clausulas.size(), args, basura);
+}
+
+int ordenGenerar(const std::vector<std::string>& args) {
+    ParametrosGenerador p;
+    if (!leerParametrosGenerador(args, p)) return 1;
+
+    const std::string salidaAsignacion = valorOpcion(args, "--asignacion", "");
+    if (!salidaAsignacion.empty() && !p.plantada) {
+        std::cerr << "❌ --asignacion sólo tiene sentido con --plantada.\n";
+        return 1;
+    }
+
+    std::vector<bool> oculta;
+    auto formula = generarFormulaAleatoria(p, &oculta);
+    if (!JsonUtils::guardarFormulaJson(args[3], p.numVars, formula)) {
+        std::cerr << "❌ Error al guardar el archivo: " << args[3] << "\n";
+        return 1;
+    }
+    std::cout << "✓ Fórmula con " << p.numVars << " variables y " << formula.size()
+              << " cláusulas guardada en: " << args[3] << "\n";
+    if (!salidaAsignacion.empty()) {
+        if (!JsonUtils::guardarAsignacionJson(salidaAsignacion, oculta)) {
+            std::cerr << "❌ Error al guardar el archivo: " << salidaAsignacion << "\n";
+            return 1;
+        }
+        std::cout << "✓ Asignación plantada guardada en: " << salidaAsignacion << "\n";
+    }
+    return 0;
+}
+
+int ordenCarga(const std::vector<std::string>& args) {
+    ParametrosGenerador p;
+    OpcionesReduccion opciones;
+    if (!leerParametrosGenerador(args, p) || !leerOpcionesReduccion(args, opciones)) return 1;
+
+    uint64_t cantidad;
+    unsigned hilos = 0;
+    if (!leerNumero(args[3], "<instancias>", cantidad) || !leerOpcionNumerica(args, "--hilos", hilos)) return 1;
+    // Todas las instancias tienen el mismo (n, m): basta comprobar una
+    if (!comprobarTamanoM(p.numVars, numClausulasGeneradas(p), args, opciones.basura)) return 1;
+
+    // --arena: todas las instancias en un LoteReduccion en lugar de una Reduccion3SATto3DM por instancia
+    auto r = tieneOpcion(args, "--arena") ? ejecutarPruebaCargaLote(p, cantidad, hilos, opciones.basura)
+                                          : ejecutarPruebaCarga(p, cantidad, hilos, opciones);
+    std::cout << "✓ " << r.instancias << " instancias (" << r.clausulas << " cláusulas, "
+              << r.tripletas << " tripletas) en " << r.segundos << " s\n";
+    if (r.segundos > 0) {
+        std::cout << "   " << (uint64_t)(r.instancias / r.segundos) << " instancias/s, "
+                  << (uint64_t)(r.tripletas / r.segundos) << " tripletas/s\n";
+    }
+    return 0;
+}
+
+// Reduce muchas fórmulas en una sola arena y las guarda en un único archivo .3dml
+int ordenLoteArena(const std::vector<std::string>& args) {
+    OpcionesReduccion opciones;
+    unsigned hilos = 0;
+    if (!leerOpcionesReduccion(args, opciones) || !leerOpcionNumerica(args, "--hilos", hilos)) return 1;
+
+    if (opciones.eliminarDuplicadas) {
+        std::cerr << "❌ --sin-duplicados no está disponible en el lote: el tamaño de cada instancia debe conocerse de antemano.\n";
+        return 1;
+    }
+
+    auto archivos = argumentosPosicionales(args, 2, {"--basura", "--hilos", "--max-tripletas"});
+    auto inicio = std::chrono::steady_clock::now();
+    LoteReduccion lote(opciones.basura);
+    lote.reservar(archivos.size(), 0);
+    for (const auto& archivo : archivos) {
+        JsonUtils::FormulaData data;
+        if (!leerFormula(archivo, data) || !comprobarTamanoM(data, args, opciones.basura)) return 1;
+        lote.agregar(data.numVars, data.clausulas);
+    }
+    auto leido = std::chrono::steady_clock::now();
+    lote.reducir(hilos);
+    auto reducido = std::chrono::steady_clock::now();
+    if (!lote.guardarArchivo(args[1])) {
+        std::cerr << "❌ Error al guardar el archivo: " << args[1] << "\n";
+        return 1;
+    }
+    auto fin = std::chrono::steady_clock::now();
+
+    auto segundos = [](auto a, auto b) { return std::chrono::duration<double>(b - a).count(); };
+    std::cout << "✓ " << lote.size() << " fórmulas (" << lote.totalClausulas() << " cláusulas, "
+              << lote.totalTripletas() << " tripletas) guardadas en: " << args[1] << "\n";
+    std::cout << "   Lectura " << segundos(inicio, leido) << " s, reducción " << segundos(leido, reducido)
+              << " s, escritura " << segundos(reducido, fin) << " s\n";
+    return 0;
+}
+
+// Resumen de un lote .3dml y, opcionalmente, de una de sus instancias
+int ordenLoteInfo(const std::vector<std::string>& args) {
+    LoteReduccion lote;
+    if (!lote.leerArchivo(args[1])) {
+        std::cerr << "❌ Lote corrupto o ilegible: " << args[1] << "\n";
+        return 1;
+    }
+    std::cout << "Instancias: " << lote.size() << "\n";
+    std::cout << "Cláusulas:  " << lote.totalClausulas() << "\n";
+    std::cout << "Tripletas:  " << lote.totalTripletas() << "\n";
+    std::cout << "Basura:     " << (lote.getVarianteBasura() == BASURA_POR_ETAPA ? "etapa" : "completa") << "\n";
+    if (args.size() < 3) return 0;
+
+    size_t i = 0;
+    if (!convertirNumero(args[2], i) || i >= lote.size()) {
+        std::cerr << "❌ Índice de instancia inválido: " << args[2] << "\n";
+        return 1;
+    }
+    SumideroHash hash;
+    for (const auto& t : lote.tripletas(i)) hash(t);
+    std::cout << "\nInstancia " << i << ": n=" << lote.numVariables(i) << ", m=" << lote.numClausulas(i) << ", "
+              << hash.total << " tripletas, huella " << std::hex << hash.huella << std::dec << "\n";
+    return 0;
+}
+
+int ordenServir(const std::vector<std::string>& args) {
+    ConfiguracionServicio config;
+    config.rutaSocket = args[1];
+    if (!leerOpcionNumerica(args, "--hilos", config.hilos) || !leerOpcionNumerica(args, "--lote", config.tamanoLote) ||
+        !leerOpcionNumerica(args, "--max-tripletas", config.maxTripletas)) {
+        return 1;
+    }
+    return ejecutarServicio(config);
+}
+
+int ordenCliente(const std::vector<std::string>& args) {
+    std::ifstream file(args[2]);
+    if (!file.is_open()) {
+        std::cerr << "❌ Error al abrir el archivo: " << args[2] << "\n";
+        return 1;
+    }
+    std::string formula((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::string formatoTexto = valorOpcion(args, "--formato", "json");
+    uint8_t formato = (formatoTexto == "compacto") ? FORMATO_COMPACTO : FORMATO_JSON;
+    unsigned repeticiones = 1;
+    if (!leerOpcionNumerica(args, "--repetir", repeticiones)) return 1;
+
+    std::string respuesta;
+    double segundos = 0.0;
+    if (!enviarPeticiones(args[1], formula, formato, repeticiones, respuesta, segundos)) {
+        std::cerr << "❌ Error en la petición al servicio" << (respuesta.empty() ? "" : ": " + respuesta) << "\n";
+        return 1;
+    }
+
+    std::string salida = valorOpcion(args, "--salida", "");
+    if (!salida.empty()) {
+        std::ofstream out(salida, std::ios::binary);
+        out.write(respuesta.data(), (std::streamsize)respuesta.size());
+        out.close();
+        if (!out) {
+            std::cerr << "❌ Error al guardar el archivo: " << salida << "\n";
+            return 1;
+        }
+    }
+    std::cout << "✓ " << repeticiones << " peticiones, " << respuesta.size() << " bytes por respuesta, "
+              << segundos * 1e6 << " µs de media\n";
+    return 0;
+}
+
+void mostrarEtapa(const std::string& nombre, const EstadisticasEtapa& e) {
+    std::cout << "   " << nombre << e.elementos << " instancias, " << e.bytes << " bytes, "
+              << e.segundosOcupada << " s ocupada, " << e.segundosBloqueada << " s bloqueada";
+    if (e.segundosOcupada > 0) {
+        std::cout << " (" << (uint64_t)(e.bytes / e.segundosOcupada / 1e6) << " MB/s)";
+    }
+    std::cout << "\n";
+}
+
+int ordenLote(const std::vector<std::string>& args) {
+    ConfiguracionPipeline config;
+    config.dirSalida = args[1];
+    config.compacto = tieneOpcion(args, "--compacto");
+    if (!leerOpcionesReduccion(args, config.opciones) || !leerLimiteTripletas(args, config.maxTripletas) ||
+        !leerOpcionNumerica(args, "--hilos", config.reductores) ||
+        !leerOpcionNumerica(args, "--lectores", config.lectores) ||
+        !leerOpcionNumerica(args, "--escritores", config.escritores) ||
+        !leerOpcionNumerica(args, "--cola", config.capacidadCola)) {
+        return 1;
+    }
+
+    auto archivos = argumentosPosicionales(args, 2, {"--hilos", "--lectores", "--escritores", "--cola", "--basura", "--max-tripletas"});
+    if (archivos.empty()) {
+        std::cerr << "❌ No se indicaron archivos de entrada.\n";
+        return 1;
+    }
+
+    auto r = ejecutarPipeline(archivos, config);
+    for (const auto& e : r.errores) {
+        std::cerr << "❌ " << e << "\n";
+    }
+    std::cout << "✓ " << r.correctos << " de " << archivos.size() << " instancias en " << r.segundos << " s\n";
+    mostrarEtapa("├─ Lectura:   ", r.lectura);
+    mostrarEtapa("├─ Reducción: ", r.reduccion);
+    mostrarEtapa("└─ Escritura: ", r.escritura);
+    return r.errores.empty() ? 0 : 1;
+}
+
+int ordenHuella(const std::vector<std::string>& args) {
+    const std::string& entrada = args[1];
+    OpcionesReduccion opciones;
+    if (!leerOpcionesReduccion(args, opciones)) return 1;
+
+    JsonUtils::FormulaData data;
+    if (!leerFormula(entrada, data) || !comprobarTamanoM(data, args, opciones.basura)) return 1;
+
+    // Sin guardar tripletas: sólo se cuentan y se calcula su huella
+    auto inicio = std::chrono::steady_clock::now();
+    SumideroHash hash;
+    reducirNucleo(data.numVars, data.clausulas, hash, opciones.basura);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "Tripletas: " << hash.total << " (esperadas "
+              << numTripletas(data.numVars, data.clausulas.size(), opciones.basura) << ")\n";
+    std::cout << "Huella:    " << std::hex << hash.huella << std::dec << "\n";
+    std::cout << "Tiempo:    " << segundos * 1e6 << " µs\n";
+    return 0;
+}
+
+void mostrarDimension(const std::string& nombre, const EstadisticasDimension& e) {
+    std::cout << "  " << nombre << ": " << e.usados << "/" << e.elementos << " usados, grado "
+              << e.gradoMinimo << ".." << e.gradoMaximo << " (media " << e.gradoMedio << ")\n";
+    for (const auto& par : e.histograma) {
+        std::cout << "     grado " << par.first << ": " << par.second << " elementos\n";
+    }
+}
+
+// Recorre una instancia codificada (.3dmz) que no supere --max-tripletas
+template <typename F>
+bool leerCompacto(const std::string& entrada, const std::vector<std::string>& args, int& n, int& m, F&& emitir) {
+    uint64_t limite;
+    if (!leerLimiteTripletas(args, limite)) return false;
+    if (limite == 0) limite = UINT64_MAX;
+    std::vector<uint8_t> datos;
+    if (!CodificadorCompacto::leerArchivo(entrada, datos)) {
+        std::cerr << "❌ Error al abrir el archivo: " << entrada << "\n";
+        return false;
+    }
+    if (!CodificadorCompacto::recorrer(datos, limite, n, m, emitir)) {
+        std::cerr << "❌ Codificación corrupta, truncada o con más tripletas que el límite (ver --max-tripletas): "
+                  << entrada << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Carga una instancia ya codificada (.3dmz) o reduce una fórmula (.json) con las opciones de args
+bool cargarInstancia(const std::string& entrada, const std::vector<std::string>& args, int& n, int& m,
+                     std::vector<TripletaCompacta>& tripletas) {
+    OpcionesReduccion opciones;
+    if (!leerOpcionesReduccion(args, opciones)) return false;
+
+    bool compacto = entrada.size() >= 5 && entrada.compare(entrada.size() - 5, 5, ".3dmz") == 0;
+    if (compacto) {
+        if (!leerCompacto(entrada, args, n, m, [&](const TripletaCompacta& t) { tripletas.push_back(t); })) {
+            return false;
+        }
+    } else {
+        JsonUtils::FormulaData data;
+        if (!leerFormula(entrada, data) || !comprobarTamanoM(data, args, opciones.basura)) return false;
+        n = data.numVars;
+        m = (int)data.clausulas.size();
+        SumideroVector<TripletaCompacta> sumidero(tripletas);
+        reducirNucleo(n, data.clausulas, sumidero, opciones.basura);
+    }
+    if (opciones.eliminarDuplicadas) {
+        eliminarDuplicadas(tripletas);
+    }
+    return true;
+}
+
+// Analiza una fórmula (.json, se reduce antes) o una instancia ya codificada (.3dmz)
+int ordenAnalizar(const std::vector<std::string>& args) {
+    unsigned hilos = 0;
+    if (!leerOpcionNumerica(args, "--hilos", hilos)) return 1;
+
+    int n = 0, m = 0;
+    std::vector<TripletaCompacta> tripletas;
+    if (!cargarInstancia(args[1], args, n, m, tripletas)) return 1;
+
+    auto inicio = std::chrono::steady_clock::now();
+    EstadisticasInstancia e = analizarInstancia(InstanciaVista{n, m, tripletas}, hilos);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "Instancia: n=" << e.n << ", m=" << e.m << ", " << e.tripletas << " tripletas\n";
+    std::cout << "  Anillo: " << e.tripletasAnillo << ", Cláusula: " << e.tripletasClausula
+              << ", Garbage: " << e.tripletasBasura << "\n";
+    mostrarDimension("W", e.w);
+    mostrarDimension("X", e.x);
+    mostrarDimension("Y", e.y);
+    std::cout << "  Fuera de rango: " << e.fueraDeRango << ", duplicadas: " << e.duplicadas << "\n";
+    std::cout << (e.valida() ? "✓ Instancia válida" : "❌ Instancia inválida") << " (" << segundos * 1e3
+              << " ms)\n";
+    return e.valida() ? 0 : 1;
+}
+
+// Escribe la instancia en un formato de otro resolutor (XCC, LP, MPS o CNF)
+int ordenExportar(const std::vector<std::string>& args) {
+    Exportador::Formato formato;
+    if (!Exportador::formatoDesdeNombre(args[2], formato)) {
+        std::cerr << "❌ Formato desconocido: " << args[2] << " (xcc|lp|mps|cnf)\n";
+        return 1;
+    }
+
+    int n = 0, m = 0;
+    std::vector<TripletaCompacta> tripletas;
+    if (!cargarInstancia(args[1], args, n, m, tripletas)) return 1;
+
+    auto inicio = std::chrono::steady_clock::now();
+    if (!Exportador::exportarArchivo(InstanciaVista{n, m, tripletas}, formato, args[3])) {
+        std::cerr << "❌ Error al exportar a: " << args[3] << "\n";
+        return 1;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "✓ " << tripletas.size() << " tripletas exportadas (" << args[2] << ", " << segundos * 1e3
+              << " ms): " << args[3] << "\n";
+    return 0;
+}
+
+// Reduce con un presupuesto de memoria y escribe el JSON leyendo los volcados por bloques
+int ordenReducir(const std::vector<std::string>& args) {
+    OpcionesReduccion opciones;
+    uint64_t megas = 0;
+    if (!leerOpcionesReduccion(args, opciones) || !leerOpcionNumerica(args, "--memoria", megas)) return 1;
+    opciones.presupuestoMemoria = megas << 20;
+    opciones.dirTemporal = valorOpcion(args, "--temporal", "");
+
+    JsonUtils::FormulaData data;
+    if (!leerFormula(args[1], data) || !comprobarTamanoM(data, args, opciones.basura)) return 1;
+
+    auto inicio = std::chrono::steady_clock::now();
+    Reduccion3SATto3DM reduccion(data.numVars, data.clausulas, opciones);
+    reduccion.generar();
+    if (!reduccion.ok()) {
+        std::cerr << "❌ No se pudieron volcar las tripletas a disco\n";
+        return 1;
+    }
+
+    std::ofstream out(args[2]);
+    if (!out.is_open()) {
+        std::cerr << "❌ Error al guardar el archivo: " << args[2] << "\n";
+        return 1;
+    }
+    int n = reduccion.getNumVariables(), m = reduccion.getNumClausulas();
+    uint64_t restantes = reduccion.getNumTripletas();
+    JsonUtils::escribirCabeceraResultadoJson(out, restantes, tamanoMatchingPerfecto(n, m));
+    bool leido = reduccion.recorrerBloques([&](Vista<TripletaCompacta> bloque) {
+        for (const auto& t : bloque) {
+            JsonUtils::escribirTripletaJson(out, aTripleta(t, n, m), --restantes == 0);
+        }
+    });
+    JsonUtils::escribirPieResultadoJson(out);
+    out.close();
+    if (!leido || !out) {
+        std::cerr << "❌ Error al escribir el archivo: " << args[2] << "\n";
+        return 1;
+    }
+
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "✓ " << reduccion.getNumTripletas() << " tripletas guardadas en " << segundos << " s: " << args[2]
+              << "\n";
+    if (reduccion.enDisco()) {
+        std::cout << "   " << (reduccion.getBytesEnDisco() >> 20) << " MB volcados a disco\n";
+    }
+    return 0;
+}
+
+// Elemento de la forma w3, x0, y12: dimensión e índice
+bool leerElemento(const std::string& elemento, int& dimension, uint64_t& id) {
+    const std::string dimensiones = "wxy";
+    size_t d = elemento.empty() ? std::string::npos : dimensiones.find(elemento[0]);
+    if (d == std::string::npos || !convertirNumero(elemento.substr(1), id)) {
+        std::cerr << "❌ Elemento inválido: " << elemento << " (ej: w3, x0, y12)\n";
+        return false;
+    }
+    dimension = (int)d;
+    return true;
+}
+
+// Tripletas que contienen un elemento (ej: w3, x0, y12), consultadas en el índice CSR
+int ordenVecinos(const std::vector<std::string>& args) {
+    const std::string& elemento = args[2];
+    int dimension;
+    uint64_t id;
+    if (!leerElemento(elemento, dimension, id)) return 1;
+
+    int n = 0, m = 0;
+    std::vector<TripletaCompacta> tripletas;
+    if (!cargarInstancia(args[1], args, n, m, tripletas)) return 1;
+
+    InstanciaVista instancia{n, m, tripletas};
+    IndiceTripletas indice;
+    if (!indice.construir(instancia) || id >= indice.tamanoDimension()) {
+        std::cerr << "❌ Elemento fuera de la instancia o instancia demasiado grande\n";
+        return 1;
+    }
+
+    Vista<uint32_t> lista = indice.de((IndiceTripletas::Dimension)dimension, (uint32_t)id);
+    for (uint32_t i : lista) {
+        Tripleta t = aTripleta(tripletas[i], n, m);
+        std::cout << "  #" << i << " [" << t.tipo << "]: (" << t.w << ", " << t.x << ", " << t.y << ")\n";
+    }
+    std::cout << "✓ " << lista.size() << " tripletas contienen " << elemento << "\n";
+    return 0;
+}
+
+// Compara la reducción con la fuerza bruta (SAT y matching) en fórmulas aleatorias pequeñas
+int ordenVerificar(const std::vector<std::string>& args) {
+    OpcionesVerificacion opciones;
+    if (!leerNumero(args[1], "<casos>", opciones.casos) || !leerOpcionNumerica(args, "--semilla", opciones.semilla) ||
+        !leerOpcionNumerica(args, "--variables", opciones.maxVariables) ||
+        !leerOpcionNumerica(args, "--clausulas", opciones.maxClausulas) ||
+        !leerOpcionNumerica(args, "--hilos", opciones.hilos)) {
+        return 1;
+    }
+    // La búsqueda del matching es exponencial: sólo instancias pequeñas
+    if (opciones.maxVariables < 1 || opciones.maxVariables > 8 || opciones.maxClausulas < 1 ||
+        opciones.maxClausulas > 8) {
+        std::cerr << "❌ --variables y --clausulas deben estar entre 1 y 8.\n";
+        return 1;
+    }
+
+    auto r = verificarAleatorias(opciones);
+    for (const auto& d : r.discrepancias) {
+        std::cerr << "❌ " << d << "\n";
+    }
+    std::cout << (r.fallos == 0 ? "✓ " : "❌ ") << r.casos << " fórmulas (" << r.satisfacibles
+              << " satisfacibles), " << r.fallos << " discrepancias, en " << r.segundos << " s\n";
+    if (r.segundos > 0) {
+        std::cout << "   " << (uint64_t)(r.casos / r.segundos) << " casos/s\n";
+    }
+    return r.fallos == 0 ? 0 : 1;
+}
+
+// Pasa archivos por el arnés de fuzzing (para AFL: --probar-entrada @@)
+int ordenProbarEntrada(const std::vector<std::string>& args) {
+    auto archivos = argumentosPosicionales(args, 1, {});
+    for (const auto& archivo : archivos) {
+        std::vector<uint8_t> datos;
+        if (!CodificadorCompacto::leerArchivo(archivo, datos)) {
+            std::cerr << "❌ No se pudo leer: " << archivo << "\n";
+            return 1;
+        }
+        probarEntrada(datos.data(), datos.size());
+    }
+    std::cout << "✓ " << archivos.size() << " entradas procesadas sin errores\n";
+    return 0;
+}
+
+// Muestra M por páginas y con filtros, formateando sólo la página pedida
+int ordenVer(const std::vector<std::string>& args) {
+    const std::string& entrada = args[1];
+    FiltroVisor filtro;
+    uint64_t pagina = 1, porPagina = 40;
+    if (!leerOpcionNumerica(args, "--variable", filtro.variable) ||
+        !leerOpcionNumerica(args, "--clausula", filtro.clausula) || !leerOpcionNumerica(args, "--pagina", pagina) ||
+        !leerOpcionNumerica(args, "--por-pagina", porPagina)) {
+        return 1;
+    }
+    const std::string tipo = valorOpcion(args, "--tipo", "todas");
+    if (tipo == "anillo") filtro.tipo = FiltroVisor::ANILLO;
+    else if (tipo == "clausula") filtro.tipo = FiltroVisor::CLAUSULA;
+    else if (tipo == "basura") filtro.tipo = FiltroVisor::BASURA;
+    else if (tipo != "todas") {
+        std::cerr << "❌ Tipo desconocido: " << tipo << " (todas, anillo, clausula o basura)\n";
+        return 1;
+    }
+    const std::string elemento = valorOpcion(args, "--elemento", "");
+    if (!elemento.empty()) {
+        uint64_t id;
+        if (!leerElemento(elemento, filtro.dimension, id)) return 1;
+        filtro.elemento = (uint32_t)std::min<uint64_t>(id, UINT32_MAX);
+    }
+
+    // El resumen sale de n y m: para una fórmula ni siquiera hace falta reducirla
+    bool compacto = entrada.size() >= 5 && entrada.compare(entrada.size() - 5, 5, ".3dmz") == 0;
+    if (tieneOpcion(args, "--resumen") && !compacto) {
+        OpcionesReduccion opciones;
+        JsonUtils::FormulaData data;
+        if (!leerOpcionesReduccion(args, opciones) || !leerFormula(entrada, data)) return 1;
+        mostrarResumen(std::cout, resumenInstancia(data.numVars, (int)data.clausulas.size(), opciones.basura));
+        return 0;
+    }
+
+    int n = 0, m = 0;
+    std::vector<TripletaCompacta> tripletas;
+    if (!cargarInstancia(entrada, args, n, m, tripletas)) return 1;
+    Visor visor(InstanciaVista{n, m, tripletas}, filtro);
+    if (tieneOpcion(args, "--resumen")) {
+        mostrarResumen(std::cout, resumenInstancia(n, m, visor.getVarianteBasura()));
+        if (!visor.estructurada()) std::cout << "(M no sigue el orden de la reducción: " << tripletas.size() << " tripletas)\n";
+        return 0;
+    }
+    if (tieneOpcion(args, "--interactivo")) {
+        visor.paginar(std::cin, std::cout, (size_t)porPagina);
+        return 0;
+    }
+
+    size_t escritas = visor.mostrar(std::cout, (pagina > 0 ? pagina - 1 : 0) * porPagina, (size_t)porPagina);
+    if (escritas == 0) std::cout << "(no hay tripletas en esta página)\n";
+    return 0;
+}
+
+// Recupera la asignación codificada en un matching de M y la comprueba contra la fórmula
+int ordenRecuperar(const std::vector<std::string>& args) {
+    OpcionesReduccion opciones;
+    JsonUtils::FormulaData data;
+    unsigned hilos = 0;
+    if (!leerOpcionNumerica(args, "--hilos", hilos)) return 1;
+    if (!leerOpcionesReduccion(args, opciones) || !leerFormula(args[1], data)) return 1;
+    if (opciones.eliminarDuplicadas) {
+        std::cerr << "❌ Las posiciones del matching se refieren a M completo: no se admite --sin-duplicados.\n";
+        return 1;
+    }
+
+    std::vector<uint64_t> matching;
+    std::string error;
+    if (!leerMatching(args[2], matching, error)) {
+        std::cerr << "❌ Error al cargar el matching: " << args[2] << "\n";
+        std::cerr << "   " << error << "\n";
+        return 1;
+    }
+
+    const int n = data.numVars, m = (int)data.clausulas.size();
+    ResultadoRecuperacion r = recuperarAsignacion(n, data.clausulas, matching, opciones.basura, hilos);
+    std::cout << (r.matchingPerfecto() ? "✓ " : "❌ ") << "Matching de " << r.tripletas << " tripletas ("
+              << tamanoMatchingPerfecto(n, m) << " en uno perfecto)\n";
+    if (!r.matchingPerfecto()) {
+        std::cout << "   Fuera de M: " << r.fueraDeRango << ", solapadas: " << r.solapadas
+                  << ", elementos sin cubrir: " << r.sinCubrir << "\n";
+    }
+    if (r.variablesIncoherentes > 0) {
+        std::cout << "❌ " << r.variablesIncoherentes << " anillos sin una única opción en todas sus etapas\n";
+    }
+    if (n <= 64) {
+        std::cout << "   Asignación:";
+        for (int v = 1; v <= n; ++v) std::cout << " " << (r.asignacion[v] ? v : -v);
+        std::cout << "\n";
+    }
+    if (r.clausulasFalsas == 0) {
+        std::cout << "✓ La asignación satisface las " << m << " cláusulas\n";
+    } else {
+        std::cout << "❌ " << r.clausulasFalsas << " cláusulas sin satisfacer (la primera, la " << r.primeraClausulaFalsa
+                  << ")\n";
+    }
+    std::cout << "   Tiempo: " << r.segundos << " s\n";
+
+    const std::string salida = valorOpcion(args, "--salida", "");
+    if (!salida.empty()) {
+        if (!JsonUtils::guardarAsignacionJson(salida, r.asignacion)) {
+            std::cerr << "❌ Error al guardar el archivo: " << salida << "\n";
+            return 1;
+        }
+        std::cout << "✓ Asignación guardada en: " << salida << "\n";
+    }
+    return r.valida() ? 0 : 1;
+}
+
+// Construye el matching perfecto que corresponde a una asignación que satisface la fórmula
+int ordenConstruirMatching(const std::vector<std::string>& args) {
+    OpcionesReduccion opciones;
+    JsonUtils::FormulaData data;
+    if (!leerOpcionesReduccion(args, opciones) || !leerFormula(args[1], data)) return 1;
+
+    int n = 0;
+    std::vector<bool> asignacion;
+    std::string error;
+    if (!JsonUtils::leerAsignacionJson(args[2], n, asignacion, error)) {
+        std::cerr << "❌ Error al cargar la asignación: " << args[2] << "\n";
+        std::cerr << "   " << error << "\n";
+        return 1;
+    }
+    if (n != data.numVars) {
+        std::cerr << "❌ La asignación tiene " << n << " variables y la fórmula " << data.numVars << "\n";
+        return 1;
+    }
+
+    std::vector<uint64_t> matching = construirMatching(n, data.clausulas, asignacion, opciones.basura);
+    if (matching.empty()) {
+        std::cerr << "❌ La asignación no satisface la fórmula.\n";
+        return 1;
+    }
+    if (!guardarMatching(args[3], matching)) {
+        std::cerr << "❌ Error al guardar el archivo: " << args[3] << "\n";
+        return 1;
+    }
+    std::cout << "✓ Matching perfecto de " << matching.size() << " tripletas guardado en: " << args[3] << "\n";
+    return 0;
+}
+
+int ordenCodificar(const std::vector<std::string>& args) {
+    const std::string& entrada = args[1];
+    const std::string& salida = args[2];
+    OpcionesReduccion opciones;
+    if (!leerOpcionesReduccion(args, opciones)) return 1;
+
+    JsonUtils::FormulaData data;
+    if (!leerFormula(entrada, data) || !comprobarTamanoM(data, args, opciones.basura)) return 1;
+
+    Reduccion3SATto3DM reduccion(data.numVars, data.clausulas, opciones);
+    reduccion.generar();
+
+    auto datos = CodificadorCompacto::codificar(reduccion.getNumVariables(), reduccion.getNumClausulas(),
+                                                reduccion.getTripletasCompactas());
+    if (!CodificadorCompacto::guardarArchivo(salida, datos)) {
+        std::cerr << "❌ Error al guardar el archivo: " << salida << "\n";
+        return 1;
+    }
+
+    std::cout << "✓ " << reduccion.getTripletasCompactas().size() << " tripletas codificadas en "
+              << datos.size() << " bytes: " << salida << "\n";
+    if (opciones.eliminarDuplicadas) {
+        std::cout << "   " << reduccion.getDuplicadasEliminadas() << " tripletas repetidas eliminadas\n";
+    }
+    return 0;
+}
+
+// Quita las tripletas repetidas de una instancia ya codificada
+int ordenDeduplicar(const std::vector<std::string>& args) {
+    unsigned hilos = 0;
+    if (!leerOpcionNumerica(args, "--hilos", hilos)) return 1;
+
+    int n = 0, m = 0;
+    std::vector<TripletaCompacta> tripletas;
+    if (!leerCompacto(args[1], args, n, m, [&](const TripletaCompacta& t) { tripletas.push_back(t); })) return 1;
+
+    auto inicio = std::chrono::steady_clock::now();
+    auto r = eliminarDuplicadas(tripletas, hilos);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!CodificadorCompacto::guardarArchivo(args[2], CodificadorCompacto::codificar(n, m, tripletas))) {
+        std::cerr << "❌ Error al guardar el archivo: " << args[2] << "\n";
+        return 1;
+    }
+    std::cout << "✓ " << r.eliminadas << " de " << r.originales << " tripletas eran repetidas ("
+              << segundos * 1e3 << " ms): " << args[2] << "\n";
+    return 0;
+}
+
+int ordenDecodificar(const std::vector<std::string>& args) {
+    const std::string& entrada = args[1];
+    const std::string& salida = args[2];
+    int n = 0, m = 0;
+    std::vector<Tripleta> tripletas;
+    if (!leerCompacto(entrada, args, n, m, [&](const TripletaCompacta& t) { tripletas.push_back(aTripleta(t, n, m)); })) {
+        return 1;
+    }
+
+    if (!JsonUtils::guardarResultadoJson(salida, tripletas, tamanoMatchingPerfecto(n, m))) {
+        std::cerr << "❌ Error al guardar el archivo JSON: " << salida << "\n";
+        return 1;
+    }
+    std::cout << "✓ " << tripletas.size() << " tripletas guardadas en JSON: " << salida << "\n";
+    return 0;
+}
+
+} // namespace
+
+void mostrarUsoLineaComandos() {
+    std::cout << "Uso: 3sat-to-3dm [orden]\n\n";
+    std::cout << "Sin argumentos se abre el menú interactivo.\n\n";
+    std::cout << "Órdenes:\n";
+    std::cout << "  --codificar <formula.json> <salida.3dmz> [--sin-duplicados] [--basura completa|etapa]\n";
+    std::cout << "                                              Reduce y guarda M en formato compacto\n";
+    std::cout << "  --decodificar <entrada.3dmz> <salida.json> [--max-tripletas T]\n";
+    std::cout << "                                              Regenera M y lo guarda en JSON\n";
+    std::cout << "  --generar <variables> <ratio> <salida.json> [--semilla S] [--plantada [--asignacion F]]\n";
+    std::cout << "                                              Genera una fórmula 3-CNF aleatoria\n";
+    std::cout << "  --carga <variables> <ratio> <instancias> [--hilos H] [--semilla S] [--plantada] [--basura B] [--arena]\n";
+    std::cout << "          [--max-tripletas T]\n";
+    std::cout << "                                              Genera y reduce instancias en paralelo\n";
+    std::cout << "  --servir <ruta.sock> [--hilos H] [--lote L] [--max-tripletas T]\n";
+    std::cout << "                                              Servicio de reducción en un socket Unix\n";
+    std::cout << "  --cliente <ruta.sock> <formula.json> [--formato json|compacto] [--repetir N] [--salida F]\n";
+    std::cout << "                                              Envía una fórmula al servicio\n";
+    std::cout << "  --lote <dir_salida> <formula.json>... [--compacto] [--sin-duplicados] [--basura B] [--hilos H] [--cola C]\n";
+    std::cout << "                                              Reduce muchos archivos solapando E/S y cálculo\n";
+    std::cout << "  --lote-arena <salida.3dml> <formula.json>... [--basura B] [--hilos H]\n";
+    std::cout << "                                              Reduce muchas fórmulas en una sola arena y un solo archivo\n";
+    std::cout << "  --lote-info <lote.3dml> [indice]            Resumen de un lote (y huella de una instancia)\n";
+    std::cout << "  --reducir <formula.json> <salida.json> [--memoria MB] [--temporal DIR] [--basura B]\n";
+    std::cout << "                                              Reduce sin pasar de MB de tripletas en memoria (vuelca a disco)\n";
+    std::cout << "  --huella <formula.json> [--basura B]        Cuenta las tripletas y calcula su huella sin guardarlas\n";
+    std::cout << "  --analizar <formula.json|instancia.3dmz> [--hilos H] [--basura B]\n";
+    std::cout << "                                              Grados por dimensión, tipos de tripleta y validez\n";
+    std::cout << "  --deduplicar <entrada.3dmz> <salida.3dmz> [--hilos H] [--max-tripletas T]\n";
+    std::cout << "                                              Quita las tripletas repetidas de una instancia\n";
+    std::cout << "  --exportar <formula.json|instancia.3dmz> <xcc|lp|mps|cnf> <salida> [--basura B] [--sin-duplicados]\n";
+    std::cout << "                                              Exporta M para resolutores de cobertura exacta, ILP o SAT\n";
+    std::cout << "  --ver <formula.json|instancia.3dmz> [--tipo anillo|clausula|basura] [--variable V] [--clausula J]\n";
+    std::cout << "        [--elemento w3] [--pagina P] [--por-pagina K] [--interactivo] [--resumen] [--basura B]\n";
+    std::cout << "                                              Visor de M por páginas y con filtros\n";
+    std::cout << "  --vecinos <formula.json|instancia.3dmz> <w|x|y><indice> [--basura B]\n";
+    std::cout << "                                              Tripletas que contienen un elemento (ej: w3)\n";
+    std::cout << "  --recuperar <formula.json> <matching.json|.3dmm> [--basura B] [--hilos H] [--salida F]\n";
+    std::cout << "                                              Asignación codificada en un matching de M, comprobada\n";
+    std::cout << "  --construir-matching <formula.json> <asignacion.json> <salida.json|.3dmm> [--basura B]\n";
+    std::cout << "                                              Matching perfecto de M para una asignación que satisface\n";
+    std::cout << "  --verificar <casos> [--semilla S] [--variables N] [--clausulas M] [--hilos H]\n";
+    std::cout << "                                              Compara la reducción con la fuerza bruta en fórmulas pequeñas\n";
+    std::cout << "  --probar-entrada <archivo>...               Pasa archivos por el arnés de fuzzing (ej: con AFL)\n";
+    std::cout << "  --ayuda                                     Muestra este mensaje\n";
+    std::cout << "\n  --basura etapa conecta cada par de basura sólo con los tips de su etapa:\n";
+    std::cout << "  2·n·m·(n-1) tripletas de basura en lugar de 2·n·m²·(n-1), con el mismo resultado.\n";
+    std::cout << "  Las órdenes que generan M lo rechazan si supera --max-tripletas T (por defecto "
+              << LIMITE_TRIPLETAS << ", 0 = sin límite).\n";
+}
+
+namespace {
+
+int ejecutarOrden(const std::vector<std::string>& args) {
+    const std::string orden = args.empty() ? "" : args[0];
+
+    if (orden == "--codificar" && args.size() >= 3) {
+        return ordenCodificar(args);
+    }
+    if (orden == "--decodificar" && args.size() >= 3) {
+        return ordenDecodificar(args);
+    }
+    if (orden == "--generar" && args.size() >= 4) {
+        return ordenGenerar(args);
+    }
+    if (orden == "--carga" && args.size() >= 4) {
+        return ordenCarga(args);
+    }
+    if (orden == "--servir" && args.size() >= 2) {
+        return ordenServir(args);
+    }
+    if (orden == "--cliente" && args.size() >= 3) {
+        return ordenCliente(args);
+    }
+    if (orden == "--lote" && args.size() >= 3) {
+        return ordenLote(args);
+    }
+    if (orden == "--lote-arena" && args.size() >= 3) {
+        return ordenLoteArena(args);
+    }
+    if (orden == "--lote-info" && args.size() >= 2) {
+        return ordenLoteInfo(args);
+    }
+    if (orden == "--huella" && args.size() >= 2) {
+        return ordenHuella(args);
+    }
+    if (orden == "--analizar" && args.size() >= 2) {
+        return ordenAnalizar(args);
+    }
+    if (orden == "--deduplicar" && args.size() >= 3) {
+        return ordenDeduplicar(args);
+    }
+    if (orden == "--exportar" && args.size() >= 4) {
+        return ordenExportar(args);
+    }
+    if (orden == "--reducir" && args.size() >= 3) {
+        return ordenReducir(args);
+    }
+    if (orden == "--ver" && args.size() >= 2) {
+        return ordenVer(args);
+    }
+    if (orden == "--vecinos" && args.size() >= 3) {
+        return ordenVecinos(args);
+    }
+    if (orden == "--recuperar" && args.size() >= 3) {
+        return ordenRecuperar(args);
+    }
+    if (orden == "--construir-matching" && args.size() >= 4) {
+        return ordenConstruirMatching(args);
+    }
+    if (orden == "--verificar" && args.size() >= 2) {
+        return ordenVerificar(args);
+    }
+    if (orden == "--probar-entrada" && args.size() >= 2) {
+        return ordenProbarEntrada(args);
+    }
+    if (orden == "--ayuda" || orden == "-h" || orden == "--help") {
+        mostrarUsoLineaComandos();
+        return 0;
+    }
+
+    std::cerr << "❌ Orden no reconocida o argumentos incorrectos.\n\n";
+    mostrarUsoLineaComandos();
+    return 2;
+}
+
+} // namespace
+
+int ejecutarLineaComandos(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+    // Una instancia dentro de los límites puede no caber en la memoria disponible
+    try {
+        return ejecutarOrden(args);
+    } catch (const std::bad_alloc&) {
+    } catch (const std::length_error&) {
+    }
+    std::cerr << "❌ Memoria insuficiente para la instancia (ver --max-tripletas)\n";
+    return 1;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file CodificadorCompacto.cpp
+ * @brief Implementación de la codificación estructurada del conjunto M
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "CodificadorCompacto.h"
+#include "NucleoReduccion.h"
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+void escribirVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((uint8_t)v);
+}
+
+void escribirZigzag(std::vector<uint8_t>& out, int64_t v) {
+    escribirVarint(out, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
+}
+
+// Comprueba si las tripletas a partir de 'inicio' coinciden con un bloque generado
+// (la generación se corta en la primera diferencia)
+template <typename Generador>
+bool coincideBloque(Vista<TripletaCompacta> tripletas, size_t inicio,
+                    uint64_t longitud, Generador generar) {
+    if (inicio + longitud > tripletas.size()) return false;
+    size_t i = inicio;
+    bool coincide = true;
+    generar([&](const TripletaCompacta& t) {
+        coincide = tripletas[i++] == t;
+        return coincide;
+    });
+    return coincide;
+}
+
+} // namespace
+
+std::vector<uint8_t> CodificadorCompacto::codificar(int n, int m, Vista<TripletaCompacta> tripletas) {
+    std::vector<uint8_t> cuerpo;
+    uint64_t numBloques = 0;
+
+    uint32_t nm = (uint32_t)n * (uint32_t)m;
+    uint64_t totalGarbage = (n > 0) ? (uint64_t)m * (n - 1) : 0;
+    uint64_t longitudAnillo = 2 * (uint64_t)m;
+
+    // La variante de basura se decide una vez por la longitud de M: con basura por
+    // etapas hay a lo sumo numTripletas(n, m, BASURA_POR_ETAPA) tripletas (menos si
+    // se quitaron duplicadas), y con la completa siempre más cuando m > 1. Con
+    // m = 1 ambas generan los mismos bloques.
+    bool basuraPorEtapa = n > 0 && m > 0 && tripletas.size() <= numTripletas(n, m, BASURA_POR_ETAPA);
+    uint64_t longitudBasura = basuraPorEtapa ? 2 * (uint64_t)n : tamanoDimension(n, m);
+    uint8_t tipoBasura = basuraPorEtapa ? BLOQUE_BASURA_ETAPA : BLOQUE_BASURA;
+
+    // Tripletas pendientes que no forman parte de ningún bloque conocido
+    size_t inicioLiteral = 0;
+    auto volcarLiteral = [&](size_t fin) {
+        if (fin == inicioLiteral) return;
+        cuerpo.push_back(BLOQUE_LITERAL);
+        escribirVarint(cuerpo, fin - inicioLiteral);
+        int64_t w = 0, x = 0, y = 0;
+        for (size_t i = inicioLiteral; i < fin; ++i) {
+            const auto& t = tripletas[i];
+            escribirZigzag(cuerpo, (int64_t)t.w - w);
+            escribirZigzag(cuerpo, (int64_t)t.x - x);
+            escribirZigzag(cuerpo, (int64_t)t.y - y);
+            w = t.w;
+            x = t.x;
+            y = t.y;
+        }
+        ++numBloques;
+    };
+
+    size_t i = 0;
+    while (i < tripletas.size()) {
+        const auto& t = tripletas[i];
+
+        // Un anillo empieza siempre con la opción True de la etapa 0
+        if (m > 0 && t.x < nm && t.x % m == 0) {
+            int var = (int)(t.x / m) + 1;
+            if (coincideBloque(tripletas, i, longitudAnillo,
+                               [&](auto&& f) { emitirAnillo(var, m, f); })) {
+                volcarLiteral(i);
+                cuerpo.push_back(BLOQUE_ANILLO);
+                escribirVarint(cuerpo, var);
+                ++numBloques;
+                i += longitudAnillo;
+                inicioLiteral = i;
+                continue;
+            }
+        }
+
+        // Un bloque de basura conecta el par k con todos los tips, o sólo con los de su etapa
+        if (t.x >= nm + (uint32_t)m && t.x - nm - m < totalGarbage) {
+            int k = (int)(t.x - nm - m);
+            if (coincideBloque(tripletas, i, longitudBasura, [&](auto&& f) {
+                    if (basuraPorEtapa) emitirBasuraEtapa(k, n, m, f);
+                    else emitirBasura(k, n, m, f);
+                })) {
+                volcarLiteral(i);
+                cuerpo.push_back(tipoBasura);
+                escribirVarint(cuerpo, k);
+                ++numBloques;
+                i += longitudBasura;
+                inicioLiteral = i;
+                continue;
+            }
+        }
+
+        ++i;
+    }
+    volcarLiteral(tripletas.size());
+
+    std::vector<uint8_t> datos = {'3', 'D', 'M', 'Z', VERSION};
+    escribirVarint(datos, n);
+    escribirVarint(datos, m);
+    escribirVarint(datos, tripletas.size());
+    escribirVarint(datos, numBloques);
+    datos.insert(datos.end(), cuerpo.begin(), cuerpo.end());
+    return datos;
+}
+
+bool CodificadorCompacto::decodificar(const std::vector<uint8_t>& datos, uint64_t maxTotal, int& n, int& m,
+                                      std::vector<TripletaCompacta>& tripletas) {
+    tripletas.clear();
+    return recorrer(datos, maxTotal, n, m, [&](const TripletaCompacta& t) { tripletas.push_back(t); });
+}
+
+bool CodificadorCompacto::guardarArchivo(const std::string& filepath, const std::vector<uint8_t>& datos) {
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(datos.data()), (std::streamsize)datos.size());
+    return (bool)file;
+}
+
+bool CodificadorCompacto::leerArchivo(const std::string& filepath, std::vector<uint8_t>& datos) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) return false;
+    datos.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
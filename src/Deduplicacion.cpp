@@ -0,0 +1,62 @@
+/**
+ * @file Deduplicacion.cpp
+ * @brief Implementación de la eliminación de tripletas repetidas
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Deduplicacion.h"
+#include "Paralelo.h"
+#include <algorithm>
+
+namespace {
+
+// Las particiones se guardan en un byte por tripleta
+constexpr unsigned MAX_HILOS = 255;
+
+uint8_t particionDe(const TripletaCompacta& t, unsigned particiones) {
+    uint64_t v = (uint64_t)t.w * 0x9e3779b97f4a7c15ull ^ (uint64_t)t.x * 0xc2b2ae3d27d4eb4full ^ t.y;
+    v ^= v >> 29;
+    return (uint8_t)(v % particiones);
+}
+
+} // namespace
+
+ResultadoDeduplicacion eliminarDuplicadas(std::vector<TripletaCompacta>& tripletas, unsigned hilos) {
+    ResultadoDeduplicacion r;
+    r.originales = tripletas.size();
+    const size_t total = tripletas.size();
+
+    hilos = std::min(hilosPara(total, hilos), MAX_HILOS);
+
+    // 1. Partición de cada tripleta, calculada por tramos
+    std::vector<uint8_t> particion(total, 0);
+    if (hilos > 1) {
+        enParalelo(hilos, [&](unsigned h) {
+            for (size_t i = total * h / hilos; i < total * (h + 1) / hilos; ++i) {
+                particion[i] = particionDe(tripletas[i], hilos);
+            }
+        });
+    }
+
+    // 2. Cada hilo marca las repetidas de su partición (la primera aparición se queda)
+    std::vector<uint8_t> repetida(total, 0);
+    enParalelo(hilos, [&](unsigned h) {
+        TablaTripletas tabla(total / hilos + 1);
+        for (size_t i = 0; i < total; ++i) {
+            if (particion[i] == h && !tabla.insertar(tripletas[i])) {
+                repetida[i] = 1;
+            }
+        }
+    });
+
+    // 3. Compactación en orden
+    size_t destino = 0;
+    for (size_t i = 0; i < total; ++i) {
+        if (!repetida[i]) tripletas[destino++] = tripletas[i];
+    }
+    tripletas.resize(destino);
+
+    r.eliminadas = total - destino;
+    return r;
+}
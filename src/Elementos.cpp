@@ -0,0 +1,71 @@
+/**
+ * @file Elementos.cpp
+ * @brief Implementación de los nombres de los elementos de la reducción
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Elementos.h"
+
+namespace {
+
+// Nombres dinámicos de variables: a, b, c, d... y v27, v28... a partir de la 27
+std::string nombreVariable(int var) {
+    if (var > 26) {
+        return "v" + std::to_string(var);
+    }
+    char letraVar = 'a' + (var - 1);
+    return std::string(1, letraVar);
+}
+
+// Nombre de un nodo de X o Y: el prefijo cambia según la dimensión
+std::string nombreNodo(uint32_t id, int n, int m,
+                       const char* anillo, const char* clausula, const char* basura) {
+    uint32_t nm = (uint32_t)n * (uint32_t)m;
+    if (id < nm) {
+        int var = (int)(id / m) + 1;
+        int etapa = (int)(id % m);
+        return anillo + nombreVariable(var) + "_" + std::to_string(etapa + 1);
+    }
+    if (id < nm + (uint32_t)m) {
+        return clausula + std::to_string(id - nm + 1);
+    }
+    return basura + std::to_string(id - nm - m + 1);
+}
+
+} // namespace
+
+std::string nombreElementoW(uint32_t id, int /*n*/, int m) {
+    int var = (int)(id / 2 / m) + 1;
+    int etapa = (int)(id / 2 % m);
+    std::string prefijo = (id & 1u) ? "w_neg_" : "w_";
+    return prefijo + nombreVariable(var) + "_" + std::to_string(etapa + 1);
+}
+
+std::string nombreElementoX(uint32_t id, int n, int m) {
+    return nombreNodo(id, n, m, "x_", "s1_c", "g1_");
+}
+
+std::string nombreElementoY(uint32_t id, int n, int m) {
+    return nombreNodo(id, n, m, "y_", "s2_c", "g2_");
+}
+
+std::string tipoTripleta(const TripletaCompacta& t, int n, int m) {
+    uint32_t nm = (uint32_t)n * (uint32_t)m;
+    if (t.x < nm) {
+        // En el anillo, la opción True cubre la punta negativa
+        std::string varName = nombreVariable((int)(t.x / m) + 1);
+        return "Var-" + varName + ((t.w & 1u) ? "-True" : "-False");
+    }
+    if (t.x < nm + (uint32_t)m) {
+        return "Clausula-" + std::to_string(t.x - nm + 1);
+    }
+    return "Garbage";
+}
+
+Tripleta aTripleta(const TripletaCompacta& t, int n, int m) {
+    return {nombreElementoW(t.w, n, m),
+            nombreElementoX(t.x, n, m),
+            nombreElementoY(t.y, n, m),
+            tipoTripleta(t, n, m)};
+}
@@ -0,0 +1,222 @@
+/**
+ * @file Exportador.cpp
+ * @brief Implementación de los escritores XCC, LP, MPS y CNF
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Exportador.h"
+#include "IndiceTripletas.h"
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+// Búfer de salida: números con std::to_chars y escrituras grandes al flujo
+class Salida {
+private:
+    static constexpr size_t CAPACIDAD = 1 << 16;
+    std::ostream& out;
+    std::vector<char> buf;
+    size_t usado = 0;
+
+    void asegurar(size_t n) {
+        if (usado + n > CAPACIDAD) volcar();
+    }
+
+public:
+    explicit Salida(std::ostream& o) : out(o), buf(CAPACIDAD) {}
+    ~Salida() { volcar(); }
+
+    void volcar() {
+        out.write(buf.data(), (std::streamsize)usado);
+        usado = 0;
+    }
+
+    Salida& operator<<(const char* s) {
+        size_t n = std::strlen(s);
+        asegurar(n);
+        std::memcpy(buf.data() + usado, s, n);
+        usado += n;
+        return *this;
+    }
+
+    Salida& operator<<(char c) {
+        asegurar(1);
+        buf[usado++] = c;
+        return *this;
+    }
+
+    Salida& operator<<(uint64_t v) {
+        asegurar(20);
+        usado = (size_t)(std::to_chars(buf.data() + usado, buf.data() + CAPACIDAD, v).ptr - buf.data());
+        return *this;
+    }
+
+    Salida& operator<<(int64_t v) {
+        asegurar(20);
+        usado = (size_t)(std::to_chars(buf.data() + usado, buf.data() + CAPACIDAD, v).ptr - buf.data());
+        return *this;
+    }
+
+    Salida& operator<<(uint32_t v) { return *this << (uint64_t)v; }
+    Salida& operator<<(int v) { return *this << (int64_t)v; }
+};
+
+const char PREFIJOS[3] = {'w', 'x', 'y'};
+
+// Elemento global e en [0, 3d): w<i>, x<i> o y<i>
+void escribirElemento(Salida& s, uint64_t e, uint64_t d) {
+    s << PREFIJOS[e / d] << (uint64_t)(e % d);
+}
+
+void escribirXCC(const InstanciaVista& inst, Salida& s) {
+    uint64_t d = tamanoDimension(inst.n, inst.m);
+    s << "| 3DM: n=" << inst.n << ", m=" << inst.m << ", " << (uint64_t)inst.tripletas.size() << " tripletas\n";
+    for (uint64_t e = 0; e < 3 * d; ++e) {
+        if (e > 0) s << ' ';
+        escribirElemento(s, e, d);
+    }
+    s << '\n';
+    for (const auto& t : inst.tripletas) {
+        s << 'w' << t.w << " x" << t.x << " y" << t.y << '\n';
+    }
+}
+
+void escribirLP(const InstanciaVista& inst, const IndiceTripletas& indice, Salida& s) {
+    const uint64_t d = tamanoDimension(inst.n, inst.m);
+    const uint64_t total = inst.tripletas.size();
+    const int TERMINOS_POR_LINEA = 16;
+
+    s << "\\ Matching perfecto 3DM: n=" << inst.n << ", m=" << inst.m << ", " << total << " tripletas\n";
+    s << "Minimize\n obj: 0 t0\nSubject To\n";
+    for (uint64_t e = 0; e < indice.numElementos(); ++e) {
+        s << ' ';
+        escribirElemento(s, e, d);
+        s << ':';
+        Vista<uint32_t> lista = indice.deGlobal(e);
+        if (lista.empty()) s << " 0 t0";
+        for (size_t k = 0; k < lista.size(); ++k) {
+            if (k > 0) s << (k % TERMINOS_POR_LINEA == 0 ? "\n   + " : " + ");
+            else s << ' ';
+            s << 't' << lista[k];
+        }
+        s << " = 1\n";
+    }
+    s << "Binary\n";
+    for (uint64_t i = 0; i < total; ++i) {
+        s << (i % TERMINOS_POR_LINEA == 0 ? (i == 0 ? " " : "\n ") : " ") << 't' << i;
+    }
+    s << "\nEnd\n";
+}
+
+void escribirMPS(const InstanciaVista& inst, Salida& s) {
+    const uint64_t d = tamanoDimension(inst.n, inst.m);
+    const uint64_t total = inst.tripletas.size();
+
+    s << "* Matching perfecto 3DM: n=" << inst.n << ", m=" << inst.m << ", " << total << " tripletas\n";
+    s << "NAME 3DM\nROWS\n N obj\n";
+    for (uint64_t e = 0; e < 3 * d; ++e) {
+        s << " E ";
+        escribirElemento(s, e, d);
+        s << '\n';
+    }
+    // Por columnas: cada tripleta aparece en las filas de sus tres elementos
+    s << "COLUMNS\n";
+    for (uint64_t i = 0; i < total; ++i) {
+        const TripletaCompacta& t = inst.tripletas[i];
+        s << " t" << i << " w" << t.w << " 1 x" << t.x << " 1\n";
+        s << " t" << i << " y" << t.y << " 1\n";
+    }
+    s << "RHS\n";
+    for (uint64_t e = 0; e < 3 * d; ++e) {
+        s << " RHS ";
+        escribirElemento(s, e, d);
+        s << " 1\n";
+    }
+    s << "BOUNDS\n";
+    for (uint64_t i = 0; i < total; ++i) {
+        s << " BV BND t" << i << '\n';
+    }
+    s << "ENDATA\n";
+}
+
+void escribirCNF(const InstanciaVista& inst, const IndiceTripletas& indice, Salida& s) {
+    const uint64_t total = inst.tripletas.size();
+
+    // Tamaños para la cabecera: por elemento con k tripletas, 1 cláusula "al
+    // menos una" y, si k >= 2, k-1 auxiliares y 3k-4 cláusulas "como mucho una"
+    uint64_t variables = total, clausulas = 0;
+    for (uint64_t e = 0; e < indice.numElementos(); ++e) {
+        uint64_t k = indice.deGlobal(e).size();
+        clausulas += 1;
+        if (k >= 2) {
+            variables += k - 1;
+            clausulas += 3 * k - 4;
+        }
+    }
+
+    s << "c Matching perfecto 3DM: n=" << inst.n << ", m=" << inst.m << ", " << total << " tripletas\n";
+    s << "c Variable i: la tripleta i-1 de M está en el matching\n";
+    s << "p cnf " << variables << ' ' << clausulas << '\n';
+
+    int64_t auxiliar = (int64_t)total; // Última variable usada
+    for (uint64_t e = 0; e < indice.numElementos(); ++e) {
+        Vista<uint32_t> x = indice.deGlobal(e);
+        for (uint32_t i : x) s << (int64_t)i + 1 << ' ';
+        s << "0\n";
+        if (x.size() < 2) continue;
+
+        // Contador secuencial: s_i indica que alguna de x_1..x_i es verdadera
+        int64_t base = auxiliar; // s_i = base + i, i en 1..k-1
+        size_t k = x.size();
+        s << -((int64_t)x[0] + 1) << ' ' << base + 1 << " 0\n";
+        for (size_t i = 2; i < k; ++i) {
+            int64_t xi = (int64_t)x[i - 1] + 1;
+            s << -xi << ' ' << base + (int64_t)i << " 0\n";
+            s << -(base + (int64_t)i - 1) << ' ' << base + (int64_t)i << " 0\n";
+            s << -xi << ' ' << -(base + (int64_t)i - 1) << " 0\n";
+        }
+        s << -((int64_t)x[k - 1] + 1) << ' ' << -(base + (int64_t)k - 1) << " 0\n";
+        auxiliar += (int64_t)k - 1;
+    }
+}
+
+} // namespace
+
+bool Exportador::formatoDesdeNombre(const std::string& nombre, Formato& formato) {
+    if (nombre == "xcc" || nombre == "dlx") formato = FORMATO_XCC;
+    else if (nombre == "lp") formato = FORMATO_LP;
+    else if (nombre == "mps") formato = FORMATO_MPS;
+    else if (nombre == "cnf") formato = FORMATO_CNF;
+    else return false;
+    return true;
+}
+
+bool Exportador::exportar(const InstanciaVista& instancia, Formato formato, std::ostream& out) {
+    if (instancia.tripletas.size() > UINT32_MAX) return false;
+
+    // LP y CNF se escriben por elementos: necesitan las tripletas de cada uno
+    IndiceTripletas indice;
+    if ((formato == FORMATO_LP || formato == FORMATO_CNF) && !indice.construir(instancia)) {
+        return false;
+    }
+    {
+        Salida s(out);
+        switch (formato) {
+            case FORMATO_XCC: escribirXCC(instancia, s); break;
+            case FORMATO_LP: escribirLP(instancia, indice, s); break;
+            case FORMATO_MPS: escribirMPS(instancia, s); break;
+            case FORMATO_CNF: escribirCNF(instancia, indice, s); break;
+        }
+    }
+    return (bool)out;
+}
+
+bool Exportador::exportarArchivo(const InstanciaVista& instancia, Formato formato, const std::string& filepath) {
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) return false;
+    return exportar(instancia, formato, file) && (bool)file.flush();
+}
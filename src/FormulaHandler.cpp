@@ -9,6 +9,7 @@
 #include "Reduccion3SATto3DM.h"
 #include "Utils.h"
 #include "JsonUtils.h"
+#include "Visor.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -55,7 +56,8 @@ bool cargarDesdeArchivo(const std::string& filepath, int& numVars, std::vector<C
     // Detectar si es JSON
     if (filepath.size() >= 5 && filepath.substr(filepath.size() - 5) == ".json") {
         auto data = JsonUtils::leerFormulaJson(filepath);
-        if (data.exito) {
+        std::string error;
+        if (data.exito && JsonUtils::literalesValidos(data, error)) {
             numVars = data.numVars;
             formula = data.clausulas;
             return true;
@@ -156,12 +158,21 @@ void ejecutarReduccion(int numVars, const std::vector<Clausula>& formula, bool d
     
     if (detalles) {
         reduccion.imprimirResultados();
+        if (reduccion.getNumTripletas() > Reduccion3SATto3DM::LIMITE_DETALLE) {
+            std::cout << "\n¿Ver todas las tripletas por páginas? (s/n): ";
+            std::string resp;
+            std::getline(std::cin, resp);
+            if (resp == "s" || resp == "S") {
+                InstanciaVista instancia{numVars, (int)formula.size(), reduccion.getTripletasCompactas()};
+                Visor(instancia).paginar(std::cin, std::cout, 40);
+            }
+        }
     } else {
         std::cout << "✅ Reducción completada exitosamente\n\n";
         std::cout << "   📊 Resumen:\n";
         std::cout << "   ├─ Variables: " << numVars << "\n";
         std::cout << "   ├─ Cláusulas: " << formula.size() << "\n";
-        std::cout << "   └─ Matching objetivo: " << (numVars * (int)formula.size()) << " tripletas\n";
+        std::cout << "   └─ Matching objetivo: " << tamanoMatchingPerfecto(numVars, (int)formula.size()) << " tripletas\n";
     }
 }
 
@@ -173,13 +184,10 @@ void guardarResultados(const std::string& filename, int numVars, const std::vect
     
     std::string fullPath = "out/" + filename;
 
-    // Silenciar salida durante la generación
-    std::cout.setstate(std::ios_base::failbit);
     Reduccion3SATto3DM reduccion(numVars, formula);
     reduccion.generar();
-    std::cout.clear();
     
-    int targetMatching = numVars * (int)formula.size();
+    uint64_t targetMatching = tamanoMatchingPerfecto(numVars, (int)formula.size());
     if (JsonUtils::guardarResultadoJson(fullPath, reduccion.getTripletas(), targetMatching)) {
         std::cout << "✓ Resultados guardados en JSON: " << fullPath << "\n";
     } else {
@@ -0,0 +1,12 @@
+/**
+ * @file FuzzEntrada.cpp
+ * @brief Punto de entrada para libFuzzer (make fuzz); no forma parte del ejecutable
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Verificador.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* datos, size_t tam) {
+    return probarEntrada(datos, tam);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file GeneradorFormulas.cpp
+ * @brief Implementación de la generación de fórmulas 3-CNF aleatorias
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "GeneradorFormulas.h"
+#include "Reduccion3SATto3DM.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+int numClausulasGeneradas(const ParametrosGenerador& p) {
+    if (p.numClausulas > 0) return p.numClausulas;
+    return (int)std::lround(p.ratio * p.numVars);
+}
+
+std::vector<Clausula> generarFormulaAleatoria(const ParametrosGenerador& p, std::vector<bool>* asignacion) {
+    std::vector<Clausula> formula;
+    int m = numClausulasGeneradas(p);
+    if (p.numVars < 3 || m <= 0) {
+        return formula;
+    }
+
+    GeneradorAleatorio rng(p.semilla);
+    uint32_t n = (uint32_t)p.numVars;
+
+    // Asignación oculta para el modo plantado
+    std::vector<bool> oculta;
+    if (p.plantada) {
+        oculta.resize(n + 1);
+        for (uint32_t v = 1; v <= n; ++v) oculta[v] = rng.moneda();
+    }
+
+    formula.reserve(m);
+    for (int j = 0; j < m; ++j) {
+        // Tres variables distintas
+        int a = (int)rng.uniforme(n) + 1;
+        int b, c;
+        do { b = (int)rng.uniforme(n) + 1; } while (b == a);
+        do { c = (int)rng.uniforme(n) + 1; } while (c == a || c == b);
+
+        Clausula cl;
+        do {
+            cl.l1 = rng.moneda() ? -a : a;
+            cl.l2 = rng.moneda() ? -b : b;
+            cl.l3 = rng.moneda() ? -c : c;
+        } while (p.plantada &&
+                 (cl.l1 > 0) != oculta[a] &&
+                 (cl.l2 > 0) != oculta[b] &&
+                 (cl.l3 > 0) != oculta[c]);
+        formula.push_back(cl);
+    }
+
+    if (asignacion) {
+        *asignacion = oculta;
+    }
+    return formula;
+}
+
+uint64_t semillaInstancia(uint64_t semillaBase, uint64_t indice) {
+    uint64_t estado = semillaBase ^ (indice * 0xd1b54a32d192ed03ull);
+    return GeneradorAleatorio::splitmix64(estado);
+}
+
+ResultadoCarga ejecutarPruebaCarga(const ParametrosGenerador& p, uint64_t cantidad, unsigned hilos,
+                                   OpcionesReduccion opciones) {
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::atomic<uint64_t> siguiente{0};
+    std::atomic<uint64_t> totalClausulas{0};
+    std::atomic<uint64_t> totalTripletas{0};
+
+    auto trabajador = [&]() {
+        uint64_t clausulas = 0, tripletas = 0;
+        for (uint64_t i = siguiente++; i < cantidad; i = siguiente++) {
+            ParametrosGenerador pi = p;
+            pi.semilla = semillaInstancia(p.semilla, i);
+            auto formula = generarFormulaAleatoria(pi);
+
+            Reduccion3SATto3DM reduccion(pi.numVars, formula, opciones);
+            reduccion.generar();
+            clausulas += formula.size();
+            tripletas += reduccion.getTripletasCompactas().size();
+        }
+        totalClausulas += clausulas;
+        totalTripletas += tripletas;
+    };
+
+    auto inicio = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> trabajadores;
+    for (unsigned h = 0; h < hilos; ++h) {
+        trabajadores.emplace_back(trabajador);
+    }
+    for (auto& t : trabajadores) {
+        t.join();
+    }
+
+    auto fin = std::chrono::steady_clock::now();
+
+    ResultadoCarga r;
+    r.instancias = cantidad;
+    r.clausulas = totalClausulas;
+    r.tripletas = totalTripletas;
+    r.segundos = std::chrono::duration<double>(fin - inicio).count();
+    return r;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file IndiceTripletas.cpp
+ * @brief Construcción paralela del índice CSR de tripletas
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "IndiceTripletas.h"
+#include "Paralelo.h"
+
+bool IndiceTripletas::construir(const InstanciaVista& instancia, unsigned hilos) {
+    const Vista<TripletaCompacta>& M = instancia.tripletas;
+    const uint64_t total = M.size();
+    d = ::tamanoDimension(instancia.n, instancia.m);
+    inicio.clear();
+    posiciones.clear();
+    if (total > UINT32_MAX) return false;
+    for (const auto& t : M) {
+        if (t.w >= d || t.x >= d || t.y >= d) return false;
+    }
+
+    const uint64_t elementos = 3 * d;
+    hilos = hilosPara(total, hilos);
+
+    // 1. Cada hilo cuenta las apariciones de cada elemento en su tramo de M
+    std::vector<std::vector<uint64_t>> cuentas(hilos);
+    enParalelo(hilos, [&](unsigned h) {
+        std::vector<uint64_t>& c = cuentas[h];
+        c.assign(elementos, 0);
+        for (uint64_t i = total * h / hilos; i < total * (h + 1) / hilos; ++i) {
+            ++c[M[i].w];
+            ++c[d + M[i].x];
+            ++c[2 * d + M[i].y];
+        }
+    });
+
+    // 2. Tamaño de cada rango de elementos, y desde ahí su inicio
+    std::vector<uint64_t> base(hilos + 1, 0);
+    enParalelo(hilos, [&](unsigned h) {
+        uint64_t suma = 0;
+        for (uint64_t e = elementos * h / hilos; e < elementos * (h + 1) / hilos; ++e) {
+            for (unsigned k = 0; k < hilos; ++k) suma += cuentas[k][e];
+        }
+        base[h + 1] = suma;
+    });
+    for (unsigned h = 0; h < hilos; ++h) {
+        base[h + 1] += base[h];
+    }
+
+    // 3. Inicio de cada lista y, dentro de ella, el hueco de cada hilo
+    inicio.resize(elementos + 1);
+    enParalelo(hilos, [&](unsigned h) {
+        uint64_t pos = base[h];
+        for (uint64_t e = elementos * h / hilos; e < elementos * (h + 1) / hilos; ++e) {
+            inicio[e] = pos;
+            for (unsigned k = 0; k < hilos; ++k) {
+                uint64_t c = cuentas[k][e];
+                cuentas[k][e] = pos;
+                pos += c;
+            }
+        }
+    });
+    inicio[elementos] = 3 * total;
+
+    // 4. Cada hilo coloca su tramo, en orden, en sus huecos
+    posiciones.resize(3 * total);
+    enParalelo(hilos, [&](unsigned h) {
+        std::vector<uint64_t>& siguiente = cuentas[h];
+        for (uint64_t i = total * h / hilos; i < total * (h + 1) / hilos; ++i) {
+            posiciones[siguiente[M[i].w]++] = (uint32_t)i;
+            posiciones[siguiente[d + M[i].x]++] = (uint32_t)i;
+            posiciones[siguiente[2 * d + M[i].y]++] = (uint32_t)i;
+        }
+    });
+    return true;
+}
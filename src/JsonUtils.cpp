@@ -3,98 +3,442 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
 
-// Función auxiliar muy simple para limpiar caracteres de formato JSON
-std::string limpiarToken(std::string s) {
-    s.erase(std::remove(s.begin(), s.end(), '\"'), s.end());
-    s.erase(std::remove(s.begin(), s.end(), ','), s.end());
-    s.erase(std::remove(s.begin(), s.end(), ':'), s.end());
-    s.erase(std::remove(s.begin(), s.end(), '['), s.end());
-    s.erase(std::remove(s.begin(), s.end(), ']'), s.end());
-    s.erase(std::remove(s.begin(), s.end(), '{'), s.end());
-    s.erase(std::remove(s.begin(), s.end(), '}'), s.end());
-    return s;
+namespace {
+
+// Profundidad máxima de los valores que se saltan (claves desconocidas)
+constexpr int PROFUNDIDAD_MAXIMA = 64;
+
+// Lector JSON con comprobación de límites. Sólo entiende lo necesario para
+// { "variables": n, "clauses": [[a, b, c], ...] } y salta cualquier otra
+// clave; nunca lanza excepciones: el primer error queda en 'error'.
+class LectorJson {
+private:
+    const char* inicio;
+    const char* p;
+    const char* fin;
+
+public:
+    std::string error;
+
+    explicit LectorJson(const std::string& texto)
+        : inicio(texto.data()), p(texto.data()), fin(texto.data() + texto.size()) {}
+
+    bool fallar(const std::string& mensaje) {
+        if (error.empty()) error = "posición " + std::to_string(p - inicio) + ": " + mensaje;
+        return false;
+    }
+
+    void espacios() {
+        while (p < fin && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) ++p;
+    }
+
+    bool alFinal() {
+        espacios();
+        return p == fin;
+    }
+
+    // Consume 'c' si es el siguiente carácter significativo
+    bool consumir(char c) {
+        espacios();
+        if (p < fin && *p == c) {
+            ++p;
+            return true;
+        }
+        return false;
+    }
+
+    bool esperar(char c) {
+        return consumir(c) || fallar(std::string("se esperaba '") + c + "'");
+    }
+
+    bool cadena(std::string& s) {
+        s.clear();
+        if (!esperar('"')) return false;
+        while (p < fin && *p != '"') {
+            unsigned char c = (unsigned char)*p++;
+            if (c < 0x20) return fallar("carácter de control en una cadena");
+            if (c != '\\') {
+                s += (char)c;
+                continue;
+            }
+            if (p == fin) break;
+            char e = *p++;
+            switch (e) {
+                case '"': case '\\': case '/': s += e; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'n': s += '\n'; break;
+                case 'r': s += '\r'; break;
+                case 't': s += '\t'; break;
+                case 'u':
+                    // Las claves que interesan son ASCII: basta con validar el escape
+                    for (int i = 0; i < 4; ++i, ++p) {
+                        if (p == fin || !std::isxdigit((unsigned char)*p)) return fallar("escape \\u inválido");
+                    }
+                    s += '?';
+                    break;
+                default:
+                    return fallar("escape inválido en una cadena");
+            }
+        }
+        if (p == fin) return fallar("cadena sin cerrar");
+        ++p;
+        return true;
+    }
+
+    // Entero JSON sin fracción ni exponente, dentro de [minimo, maximo]
+    bool entero(int64_t minimo, int64_t maximo, int64_t& valor) {
+        espacios();
+        bool negativo = p < fin && *p == '-';
+        if (negativo) ++p;
+        if (p == fin || !std::isdigit((unsigned char)*p)) return fallar("se esperaba un entero");
+        if (*p == '0' && p + 1 < fin && std::isdigit((unsigned char)p[1])) return fallar("entero con ceros a la izquierda");
+        const int64_t limite = negativo ? -minimo : maximo;
+        int64_t v = 0;
+        while (p < fin && std::isdigit((unsigned char)*p)) {
+            v = v * 10 + (*p++ - '0');
+            if (v > limite) return fallar("entero fuera de rango");
+        }
+        if (p < fin && (*p == '.' || *p == 'e' || *p == 'E')) return fallar("se esperaba un entero");
+        valor = negativo ? -v : v;
+        return true;
+    }
+
+    // Salta un valor JSON cualquiera, comprobando su sintaxis
+    bool saltarValor(int profundidad) {
+        if (profundidad > PROFUNDIDAD_MAXIMA) return fallar("anidamiento demasiado profundo");
+        espacios();
+        if (p == fin) return fallar("se esperaba un valor");
+        std::string basura;
+        switch (*p) {
+            case '"':
+                return cadena(basura);
+            case '[':
+                ++p;
+                if (consumir(']')) return true;
+                do {
+                    if (!saltarValor(profundidad + 1)) return false;
+                } while (consumir(','));
+                return esperar(']');
+            case '{':
+                ++p;
+                if (consumir('}')) return true;
+                do {
+                    if (!cadena(basura) || !esperar(':') || !saltarValor(profundidad + 1)) return false;
+                } while (consumir(','));
+                return esperar('}');
+            case 't': return palabra("true");
+            case 'f': return palabra("false");
+            case 'n': return palabra("null");
+            default:
+                return numero();
+        }
+    }
+
+private:
+    bool palabra(const char* w) {
+        for (; *w; ++w, ++p) {
+            if (p == fin || *p != *w) return fallar("valor inválido");
+        }
+        return true;
+    }
+
+    // Número JSON general: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    bool numero() {
+        auto digitos = [&]() {
+            const char* desde = p;
+            while (p < fin && std::isdigit((unsigned char)*p)) ++p;
+            return p > desde;
+        };
+        if (p < fin && *p == '-') ++p;
+        if (p < fin && *p == '0') ++p;
+        else if (!digitos()) return fallar("valor inválido");
+        if (p < fin && *p == '.') {
+            ++p;
+            if (!digitos()) return fallar("número inválido");
+        }
+        if (p < fin && (*p == 'e' || *p == 'E')) {
+            ++p;
+            if (p < fin && (*p == '+' || *p == '-')) ++p;
+            if (!digitos()) return fallar("número inválido");
+        }
+        return true;
+    }
+};
+
+// "clauses": [[a, b, c], ...], cada cláusula con exactamente tres literales
+bool leerClausulas(LectorJson& in, std::vector<Clausula>& clausulas) {
+    if (!in.esperar('[')) return false;
+    if (in.consumir(']')) return true;
+    do {
+        int64_t l[3];
+        if (!in.esperar('[')) return false;
+        for (int i = 0; i < 3; ++i) {
+            if (i > 0 && !in.consumir(',')) {
+                return in.fallar("la cláusula " + std::to_string(clausulas.size() + 1) + " tiene menos de 3 literales");
+            }
+            if (!in.entero(INT32_MIN + 1, INT32_MAX, l[i])) return false;
+        }
+        if (!in.consumir(']')) {
+            return in.fallar("la cláusula " + std::to_string(clausulas.size() + 1) + " tiene más de 3 literales");
+        }
+        clausulas.push_back({(int)l[0], (int)l[1], (int)l[2]});
+    } while (in.consumir(','));
+    return in.esperar(']');
 }
 
-JsonUtils::FormulaData JsonUtils::leerFormulaJson(const std::string& filepath) {
-    FormulaData data = {0, {}, false};
+// [a, b, ...] con enteros en [minimo, maximo]
+bool leerListaEnteros(LectorJson& in, int64_t minimo, int64_t maximo, std::vector<int64_t>& lista) {
+    if (!in.esperar('[')) return false;
+    if (in.consumir(']')) return true;
+    do {
+        int64_t v = 0;
+        if (!in.entero(minimo, maximo, v)) return false;
+        lista.push_back(v);
+    } while (in.consumir(','));
+    return in.esperar(']');
+}
+
+std::string leerTexto(const std::string& filepath, bool& exito) {
     std::ifstream file(filepath);
-    
-    if (!file.is_open()) return data;
-
-    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    
-    // Parser muy básico específico para este formato
-    // Busca "variables": X
-    size_t varPos = content.find("\"variables\"");
-    if (varPos != std::string::npos) {
-        size_t colonPos = content.find(":", varPos);
-        size_t commaPos = content.find(",", colonPos);
-        if (colonPos != std::string::npos) {
-            std::string numStr = content.substr(colonPos + 1, commaPos - colonPos - 1);
-            data.numVars = std::stoi(limpiarToken(numStr));
+    exito = file.is_open();
+    return exito ? std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()) : "";
+}
+
+} // namespace
+
+JsonUtils::FormulaData JsonUtils::leerFormulaJson(const std::string& filepath) {
+    bool abierto;
+    std::string content = leerTexto(filepath, abierto);
+    if (!abierto) return {0, {}, false, "no se pudo abrir " + filepath};
+
+    return leerFormulaJsonTexto(content);
+}
+
+JsonUtils::FormulaData JsonUtils::leerFormulaJsonTexto(const std::string& content) {
+    FormulaData data = {0, {}, false, ""};
+    LectorJson in(content);
+    bool vistaVariables = false, vistasClausulas = false;
+
+    bool ok = in.esperar('{');
+    if (ok && !in.consumir('}')) {
+        do {
+            std::string clave;
+            if (!(ok = in.cadena(clave) && in.esperar(':'))) break;
+            if (clave == "variables") {
+                int64_t v = 0;
+                ok = (!vistaVariables || in.fallar("\"variables\" repetida")) && in.entero(0, INT32_MAX, v);
+                data.numVars = (int)v;
+                vistaVariables = true;
+            } else if (clave == "clauses") {
+                ok = (!vistasClausulas || in.fallar("\"clauses\" repetida")) && leerClausulas(in, data.clausulas);
+                vistasClausulas = true;
+            } else {
+                ok = in.saltarValor(1);
+            }
+        } while (ok && in.consumir(','));
+        ok = ok && in.esperar('}');
+    }
+    ok = ok && (in.alFinal() || in.fallar("texto sobrante tras el objeto"));
+
+    if (ok && !vistaVariables) ok = in.fallar("falta \"variables\"");
+    if (ok && !vistasClausulas) ok = in.fallar("falta \"clauses\"");
+    if (ok && data.numVars == 0) ok = in.fallar("\"variables\" debe ser positivo");
+    if (ok && data.clausulas.empty()) ok = in.fallar("la fórmula no tiene cláusulas");
+
+    data.exito = ok;
+    data.error = in.error;
+    if (!ok) {
+        data.numVars = 0;
+        data.clausulas.clear();
+    }
+    return data;
+}
+
+bool JsonUtils::literalesValidos(const FormulaData& data, std::string& error) {
+    for (const auto& c : data.clausulas) {
+        for (int lit : {c.l1, c.l2, c.l3}) {
+            if (lit == 0 || std::abs(lit) > data.numVars) {
+                error = "Literal fuera de rango: " + std::to_string(lit);
+                return false;
+            }
         }
     }
+    return true;
+}
 
-    // Busca "clauses": [[...], [...]]
-    size_t clausesPos = content.find("\"clauses\"");
-    if (clausesPos != std::string::npos) {
-        size_t startArr = content.find("[", clausesPos);
-        size_t endArr = content.rfind("]"); // Último corchete
-        
-        if (startArr != std::string::npos && endArr != std::string::npos) {
-            std::string arrayContent = content.substr(startArr + 1, endArr - startArr - 1);
-            
-            // Procesar manualmente los subarrays
-            std::vector<int> currentClause;
-            std::string currentNum;
-            bool inNumber = false;
-            
-            for (size_t i = 0; i < arrayContent.length(); ++i) {
-                char c = arrayContent[i];
-                
-                if (c == '-' || isdigit(c)) {
-                    currentNum += c;
-                    inNumber = true;
-                } else if (inNumber) {
-                    currentClause.push_back(std::stoi(currentNum));
-                    currentNum = "";
-                    inNumber = false;
-                    
-                    if (currentClause.size() == 3) {
-                        data.clausulas.push_back({currentClause[0], currentClause[1], currentClause[2]});
-                        currentClause.clear();
-                    }
+bool JsonUtils::guardarFormulaJson(const std::string& filepath, int numVars, const std::vector<Clausula>& clausulas) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) return false;
+
+    file << "{\n";
+    file << "  \"variables\": " << numVars << ",\n";
+    file << "  \"clauses\": [\n";
+
+    for (size_t i = 0; i < clausulas.size(); ++i) {
+        const auto& c = clausulas[i];
+        file << "    [" << c.l1 << ", " << c.l2 << ", " << c.l3 << "]"
+             << (i < clausulas.size() - 1 ? "," : "") << "\n";
+    }
+
+    file << "  ]\n";
+    file << "}\n";
+
+    return true;
+}
+
+bool JsonUtils::leerIndicesJsonTexto(const std::string& content, std::vector<uint64_t>& indices, std::string& error) {
+    LectorJson in(content);
+    std::vector<int64_t> lista;
+    bool ok;
+    if (in.consumir('{')) {
+        bool vista = false;
+        ok = true;
+        if (!in.consumir('}')) {
+            do {
+                std::string clave;
+                if (!(ok = in.cadena(clave) && in.esperar(':'))) break;
+                if (clave == "matching") {
+                    ok = (!vista || in.fallar("\"matching\" repetida")) && leerListaEnteros(in, 0, INT64_MAX, lista);
+                    vista = true;
+                } else {
+                    ok = in.saltarValor(1);
                 }
+            } while (ok && in.consumir(','));
+            ok = ok && in.esperar('}');
+        }
+        ok = ok && (vista || in.fallar("falta \"matching\""));
+    } else {
+        ok = leerListaEnteros(in, 0, INT64_MAX, lista);
+    }
+    ok = ok && (in.alFinal() || in.fallar("texto sobrante tras el matching"));
+
+    indices.clear();
+    error = in.error;
+    if (!ok) return false;
+    indices.assign(lista.begin(), lista.end());
+    return true;
+}
+
+bool JsonUtils::guardarIndicesJson(const std::string& filepath, const std::vector<uint64_t>& indices) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) return false;
+
+    file << "{\n  \"matching\": [";
+    for (size_t i = 0; i < indices.size(); ++i) {
+        file << (i % 16 == 0 ? "\n    " : " ") << indices[i] << (i < indices.size() - 1 ? "," : "");
+    }
+    file << "\n  ]\n}\n";
+    return (bool)file;
+}
+
+bool JsonUtils::leerAsignacionJson(const std::string& filepath, int& numVars, std::vector<bool>& asignacion,
+                                   std::string& error) {
+    bool abierto;
+    std::string content = leerTexto(filepath, abierto);
+    if (!abierto) {
+        error = "no se pudo abrir " + filepath;
+        return false;
+    }
+
+    LectorJson in(content);
+    int64_t n = 0;
+    std::vector<int64_t> literales;
+    bool vistaVariables = false, vistaAsignacion = false;
+    bool ok = in.esperar('{');
+    if (ok && !in.consumir('}')) {
+        do {
+            std::string clave;
+            if (!(ok = in.cadena(clave) && in.esperar(':'))) break;
+            if (clave == "variables") {
+                ok = (!vistaVariables || in.fallar("\"variables\" repetida")) && in.entero(1, INT32_MAX, n);
+                vistaVariables = true;
+            } else if (clave == "assignment") {
+                ok = (!vistaAsignacion || in.fallar("\"assignment\" repetida")) &&
+                     leerListaEnteros(in, INT32_MIN + 1, INT32_MAX, literales);
+                vistaAsignacion = true;
+            } else {
+                ok = in.saltarValor(1);
             }
+        } while (ok && in.consumir(','));
+        ok = ok && in.esperar('}');
+    }
+    ok = ok && (in.alFinal() || in.fallar("texto sobrante tras el objeto"));
+    if (ok && !vistaVariables) ok = in.fallar("falta \"variables\"");
+    if (ok && !vistaAsignacion) ok = in.fallar("falta \"assignment\"");
+    error = in.error;
+    if (!ok) return false;
+
+    // Cada variable aparece como mucho una vez, con cualquier signo
+    std::vector<bool> vista(n + 1, false);
+    asignacion.assign(n + 1, false);
+    for (int64_t literal : literales) {
+        int64_t v = std::abs(literal);
+        if (v == 0 || v > n) {
+            error = "Literal fuera de rango: " + std::to_string(literal);
+            return false;
         }
+        if (vista[v]) {
+            error = "la variable " + std::to_string(v) + " aparece más de una vez";
+            return false;
+        }
+        vista[v] = true;
+        asignacion[v] = literal > 0;
     }
+    numVars = (int)n;
+    return true;
+}
 
-    data.exito = (data.numVars > 0 && !data.clausulas.empty());
-    return data;
+bool JsonUtils::guardarAsignacionJson(const std::string& filepath, const std::vector<bool>& asignacion) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) return false;
+
+    const size_t n = asignacion.empty() ? 0 : asignacion.size() - 1;
+    file << "{\n  \"variables\": " << n << ",\n  \"assignment\": [";
+    for (size_t v = 1; v <= n; ++v) {
+        file << (v % 16 == 1 ? "\n    " : " ") << (asignacion[v] ? (int64_t)v : -(int64_t)v) << (v < n ? "," : "");
+    }
+    file << "\n  ]\n}\n";
+    return (bool)file;
 }
 
-bool JsonUtils::guardarResultadoJson(const std::string& filepath, const std::vector<Tripleta>& tripletas, int targetMatching) {
+bool JsonUtils::guardarResultadoJson(const std::string& filepath, const std::vector<Tripleta>& tripletas, uint64_t targetMatching) {
     std::ofstream file(filepath);
     if (!file.is_open()) return false;
 
+    escribirResultadoJson(file, tripletas, targetMatching);
+    return true;
+}
+
+void JsonUtils::escribirResultadoJson(std::ostream& file, const std::vector<Tripleta>& tripletas, uint64_t targetMatching) {
+    escribirCabeceraResultadoJson(file, tripletas.size(), targetMatching);
+    for (size_t i = 0; i < tripletas.size(); ++i) {
+        escribirTripletaJson(file, tripletas[i], i == tripletas.size() - 1);
+    }
+    escribirPieResultadoJson(file);
+}
+
+void JsonUtils::escribirCabeceraResultadoJson(std::ostream& file, uint64_t totalTripletas, uint64_t targetMatching) {
     file << "{\n";
-    file << "  \"totalTriplets\": " << tripletas.size() << ",\n";
+    file << "  \"totalTriplets\": " << totalTripletas << ",\n";
     file << "  \"targetMatchingSize\": " << targetMatching << ",\n";
     file << "  \"triplets\": [\n";
+}
 
-    for (size_t i = 0; i < tripletas.size(); ++i) {
-        const auto& t = tripletas[i];
-        file << "    {\n";
-        file << "      \"w\": \"" << t.w << "\",\n";
-        file << "      \"x\": \"" << t.x << "\",\n";
-        file << "      \"y\": \"" << t.y << "\",\n";
-        file << "      \"type\": \"" << t.tipo << "\"\n";
-        file << "    }" << (i < tripletas.size() - 1 ? "," : "") << "\n";
-    }
+void JsonUtils::escribirTripletaJson(std::ostream& file, const Tripleta& t, bool ultima) {
+    file << "    {\n";
+    file << "      \"w\": \"" << t.w << "\",\n";
+    file << "      \"x\": \"" << t.x << "\",\n";
+    file << "      \"y\": \"" << t.y << "\",\n";
+    file << "      \"type\": \"" << t.tipo << "\"\n";
+    file << "    }" << (ultima ? "" : ",") << "\n";
+}
 
+void JsonUtils::escribirPieResultadoJson(std::ostream& file) {
     file << "  ]\n";
     file << "}\n";
-    
-    return true;
 }
@@ -0,0 +1,246 @@
+/**
+ * @file LoteReduccion.cpp
+ * @brief Implementación de la reducción por lotes en una arena compartida
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "LoteReduccion.h"
+#include "NucleoReduccion.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+const char MAGICO[4] = {'3', 'D', 'M', 'L'};
+
+// El archivo es little-endian: en una máquina little-endian los arreglos se
+// copian tal cual, en otra se invierte cada palabra (int, uint32_t o uint64_t)
+constexpr bool LITTLE_ENDIAN_NATIVO = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+constexpr size_t BYTES_BLOQUE = 1 << 16;
+
+void invertirPalabras(char* datos, size_t bytes, size_t bytesPalabra) {
+    for (size_t i = 0; i + bytesPalabra <= bytes; i += bytesPalabra) {
+        std::reverse(datos + i, datos + i + bytesPalabra);
+    }
+}
+
+// Palabra: tipo de los campos de T (T = Clausula se guarda como int)
+template <typename Palabra, typename T>
+void escribirArreglo(std::ofstream& file, const T* datos, uint64_t cuenta) {
+    static_assert(sizeof(T) % sizeof(Palabra) == 0, "T debe estar formado por palabras");
+    const char* p = reinterpret_cast<const char*>(datos);
+    const uint64_t bytes = cuenta * sizeof(T);
+    if (LITTLE_ENDIAN_NATIVO) {
+        file.write(p, (std::streamsize)bytes);
+        return;
+    }
+    // Por bloques, para no duplicar la arena en memoria
+    std::vector<char> bloque;
+    for (uint64_t hecho = 0; hecho < bytes; hecho += BYTES_BLOQUE) {
+        const size_t tam = (size_t)std::min<uint64_t>(BYTES_BLOQUE, bytes - hecho);
+        bloque.assign(p + hecho, p + hecho + tam);
+        invertirPalabras(bloque.data(), tam, sizeof(Palabra));
+        file.write(bloque.data(), (std::streamsize)tam);
+    }
+}
+
+template <typename Palabra, typename T>
+bool leerArreglo(std::ifstream& file, T* datos, uint64_t cuenta) {
+    static_assert(sizeof(T) % sizeof(Palabra) == 0, "T debe estar formado por palabras");
+    const uint64_t bytes = cuenta * sizeof(T);
+    file.read(reinterpret_cast<char*>(datos), (std::streamsize)bytes);
+    if (!LITTLE_ENDIAN_NATIVO) invertirPalabras(reinterpret_cast<char*>(datos), (size_t)bytes, sizeof(Palabra));
+    return (bool)file;
+}
+
+// Desplazamientos que empiezan en 0, no decrecen y terminan en 'total'
+bool desplazamientosValidos(const std::vector<uint64_t>& inicio, uint64_t total) {
+    if (inicio.front() != 0 || inicio.back() != total) return false;
+    for (size_t i = 1; i < inicio.size(); ++i) {
+        if (inicio[i] < inicio[i - 1]) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+LoteReduccion::LoteReduccion(VarianteBasura b) : basura(b) {}
+
+void LoteReduccion::reservar(size_t instancias, size_t totalClausulas) {
+    variables.reserve(instancias);
+    inicioClausulas.reserve(instancias + 1);
+    clausulas.reserve(totalClausulas);
+}
+
+bool LoteReduccion::instanciaValida(int n, Vista<Clausula> formula, VarianteBasura basura) {
+    std::string error;
+    if (formula.size() > INT32_MAX || !instanciaAbarcable(n, (int)formula.size(), basura, 0, error)) return false;
+    for (const auto& c : formula) {
+        for (int literal : {c.l1, c.l2, c.l3}) {
+            if (literal == 0 || literal < -n || literal > n) return false;
+        }
+    }
+    return true;
+}
+
+bool LoteReduccion::agregar(int n, Vista<Clausula> formula) {
+    if (!instanciaValida(n, formula, basura)) return false;
+    variables.push_back(n);
+    clausulas.insert(clausulas.end(), formula.begin(), formula.end());
+    inicioClausulas.push_back(clausulas.size());
+    reducidas = false;
+    return true;
+}
+
+uint64_t LoteReduccion::reducir(unsigned hilos) {
+    const size_t instancias = size();
+
+    // El tamaño de cada instancia se conoce sin reducirla: una sola reserva
+    inicioTripletas.assign(instancias + 1, 0);
+    for (size_t i = 0; i < instancias; ++i) {
+        inicioTripletas[i + 1] = inicioTripletas[i] + numTripletas(variables[i], numClausulas(i), basura);
+    }
+    const uint64_t total = inicioTripletas.back();
+    arena.reset(new TripletaCompacta[total]);
+
+    // Cada hilo reduce las instancias que empiezan en su tramo de la arena,
+    // así el reparto queda equilibrado por tripletas y no por instancias
+    hilos = hilosPara(total, hilos);
+    std::vector<size_t> primera(hilos + 1, instancias);
+    for (unsigned h = 0; h < hilos; ++h) {
+        primera[h] = (size_t)(std::lower_bound(inicioTripletas.begin(), inicioTripletas.begin() + instancias,
+                                               total * h / hilos) - inicioTripletas.begin());
+    }
+    enParalelo(hilos, [&](unsigned h) {
+        for (size_t i = primera[h]; i < primera[h + 1]; ++i) {
+            SumideroPuntero sumidero{arena.get() + inicioTripletas[i]};
+            reducirNucleo(variables[i], formula(i), sumidero, basura);
+        }
+    });
+
+    reducidas = true;
+    return total;
+}
+
+bool LoteReduccion::coherente() const {
+    // Los desplazamientos ya son crecientes y acaban en el total de su tabla
+    for (size_t i = 0; i < size(); ++i) {
+        const int n = variables[i];
+        const size_t m = (size_t)(inicioClausulas[i + 1] - inicioClausulas[i]);
+        if (!instanciaValida(n, Vista<Clausula>(clausulas.data() + inicioClausulas[i], m), basura) ||
+            inicioTripletas[i + 1] - inicioTripletas[i] != numTripletas(n, (int)m, basura)) {
+            return false;
+        }
+        const uint64_t dimension = tamanoDimension(n, (int)m);
+        for (const auto& t : tripletas(i)) {
+            if (t.w >= dimension || t.x >= dimension || t.y >= dimension) return false;
+        }
+    }
+    return true;
+}
+
+bool LoteReduccion::guardarArchivo(const std::string& filepath) const {
+    if (!reducidas) return false;
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    const uint64_t cabecera[3] = {size(), totalClausulas(), totalTripletas()};
+    const uint8_t version[2] = {VERSION, (uint8_t)basura};
+    file.write(MAGICO, 4);
+    escribirArreglo<uint8_t>(file, version, 2);
+    escribirArreglo<uint64_t>(file, cabecera, 3);
+    escribirArreglo<int>(file, variables.data(), variables.size());
+    escribirArreglo<uint64_t>(file, inicioClausulas.data(), inicioClausulas.size());
+    escribirArreglo<int>(file, clausulas.data(), clausulas.size());
+    escribirArreglo<uint64_t>(file, inicioTripletas.data(), inicioTripletas.size());
+    escribirArreglo<uint32_t>(file, arena.get(), totalTripletas());
+    return (bool)file.flush();
+}
+
+bool LoteReduccion::leerArchivo(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    const uint64_t tamArchivo = (uint64_t)file.tellg();
+    file.seekg(0);
+
+    char magico[4];
+    uint8_t version[2];
+    uint64_t cabecera[3];
+    if (!leerArreglo<char>(file, magico, 4) || std::memcmp(magico, MAGICO, 4) != 0 ||
+        !leerArreglo<uint8_t>(file, version, 2) || version[0] != VERSION || version[1] > BASURA_POR_ETAPA ||
+        !leerArreglo<uint64_t>(file, cabecera, 3)) {
+        return false;
+    }
+
+    // Los tamaños de la cabecera deben cuadrar con el archivo antes de reservar nada
+    const uint64_t instancias = cabecera[0], numClausulas = cabecera[1], numTripletasLote = cabecera[2];
+    const uint64_t leidos = 4 + 2 + sizeof(cabecera);
+    const uint64_t restantes = tamArchivo - leidos;
+    if (tamArchivo < leidos || instancias > restantes || numClausulas > restantes || numTripletasLote > restantes ||
+        instancias * sizeof(int) + 2 * (instancias + 1) * sizeof(uint64_t) + numClausulas * sizeof(Clausula) +
+        numTripletasLote * sizeof(TripletaCompacta) != restantes) {
+        return false;
+    }
+
+    basura = (VarianteBasura)version[1];
+    variables.resize(instancias);
+    inicioClausulas.resize(instancias + 1);
+    clausulas.resize(numClausulas);
+    inicioTripletas.resize(instancias + 1);
+    arena.reset(new TripletaCompacta[numTripletasLote]);
+    reducidas = true; // Para que coherente() vea las tripletas
+    if (!leerArreglo<int>(file, variables.data(), instancias) ||
+        !leerArreglo<uint64_t>(file, inicioClausulas.data(), instancias + 1) ||
+        !leerArreglo<int>(file, clausulas.data(), numClausulas) ||
+        !leerArreglo<uint64_t>(file, inicioTripletas.data(), instancias + 1) ||
+        !leerArreglo<uint32_t>(file, arena.get(), numTripletasLote) ||
+        !desplazamientosValidos(inicioClausulas, numClausulas) ||
+        !desplazamientosValidos(inicioTripletas, numTripletasLote) || !coherente()) {
+        variables.clear();
+        inicioClausulas.assign(1, 0);
+        clausulas.clear();
+        inicioTripletas.assign(1, 0);
+        arena.reset();
+        reducidas = false;
+        return false;
+    }
+    return true;
+}
+
+ResultadoCarga ejecutarPruebaCargaLote(const ParametrosGenerador& p, uint64_t cantidad, unsigned hilos,
+                                       VarianteBasura basura) {
+    auto inicio = std::chrono::steady_clock::now();
+    hilos = hilosPara(cantidad, hilos, 1);
+
+    // Generación en paralelo, cada hilo en un vector plano para su tramo
+    std::vector<std::vector<Clausula>> generadas(hilos);
+    enParalelo(hilos, [&](unsigned h) {
+        for (uint64_t i = cantidad * h / hilos; i < cantidad * (h + 1) / hilos; ++i) {
+            ParametrosGenerador pi = p;
+            pi.semilla = semillaInstancia(p.semilla, i);
+            auto formula = generarFormulaAleatoria(pi);
+            generadas[h].insert(generadas[h].end(), formula.begin(), formula.end());
+        }
+    });
+
+    // Todas las instancias de una prueba de carga tienen las mismas m cláusulas
+    LoteReduccion lote(basura);
+    const size_t m = (size_t)numClausulasGeneradas(p);
+    lote.reservar((size_t)cantidad, (size_t)cantidad * m);
+    for (const auto& tramo : generadas) {
+        for (size_t desde = 0; m > 0 && desde < tramo.size(); desde += m) {
+            lote.agregar(p.numVars, Vista<Clausula>(tramo.data() + desde, m));
+        }
+    }
+
+    ResultadoCarga r;
+    r.tripletas = lote.reducir(hilos);
+    r.instancias = lote.size();
+    r.clausulas = lote.totalClausulas();
+    r.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return r;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file Pipeline.cpp
+ * @brief Implementación del pipeline lectura → reducción → escritura
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Pipeline.h"
+#include "ColaAcotada.h"
+#include "CodificadorCompacto.h"
+#include "JsonUtils.h"
+#include "Reduccion3SATto3DM.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Reloj = std::chrono::steady_clock;
+
+uint64_t nanosDesde(Reloj::time_point inicio) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Reloj::now() - inicio).count();
+}
+
+struct Contadores {
+    std::atomic<uint64_t> elementos{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> nanosOcupada{0};
+    std::atomic<uint64_t> nanosBloqueada{0};
+
+    EstadisticasEtapa valor() const {
+        EstadisticasEtapa e;
+        e.elementos = elementos;
+        e.bytes = bytes;
+        e.segundosOcupada = nanosOcupada / 1e9;
+        e.segundosBloqueada = nanosBloqueada / 1e9;
+        return e;
+    }
+};
+
+// Fórmula ya leída, pendiente de reducir
+struct Leida {
+    std::string salida;
+    JsonUtils::FormulaData data;
+};
+
+// Resultado serializado, pendiente de escribir
+struct Serializada {
+    std::string salida;
+    std::string contenido;
+};
+
+// Pone un elemento en la cola contando el tiempo bloqueado por contrapresión
+template <typename T>
+bool ponerMidiendo(ColaAcotada<T>& cola, T valor, Contadores& c) {
+    auto inicio = Reloj::now();
+    bool ok = cola.poner(std::move(valor));
+    c.nanosBloqueada += nanosDesde(inicio);
+    return ok;
+}
+
+// Lanza 'hilos' hilos con 'trabajo'; el último en terminar cierra la cola siguiente
+template <typename T>
+void lanzarEtapa(std::vector<std::thread>& todos, unsigned hilos, std::function<void()> trabajo,
+                 ColaAcotada<T>* siguiente) {
+    auto restantes = std::make_shared<std::atomic<unsigned>>(hilos);
+    for (unsigned h = 0; h < hilos; ++h) {
+        todos.emplace_back([trabajo, siguiente, restantes]() {
+            trabajo();
+            if (--*restantes == 0 && siguiente) siguiente->cerrar();
+        });
+    }
+}
+
+} // namespace
+
+ResultadoPipeline ejecutarPipeline(const std::vector<std::string>& archivos, const ConfiguracionPipeline& config) {
+    ResultadoPipeline resultado;
+    std::mutex mtxErrores;
+    auto registrarError = [&](const std::string& mensaje) {
+        std::lock_guard<std::mutex> lock(mtxErrores);
+        resultado.errores.push_back(mensaje);
+    };
+
+    std::error_code ec;
+    fs::create_directories(config.dirSalida, ec);
+
+    ColaAcotada<Leida> colaReduccion(config.capacidadCola);
+    ColaAcotada<Serializada> colaEscritura(config.capacidadCola);
+    Contadores lectura, reduccion, escritura;
+    std::atomic<size_t> siguienteArchivo{0};
+    std::atomic<uint64_t> correctos{0};
+
+    const std::string extension = config.compacto ? ".3dmz" : ".json";
+    unsigned reductores = config.reductores ? config.reductores : std::max(1u, std::thread::hardware_concurrency());
+
+    auto trabajoLectura = [&]() {
+        for (size_t i = siguienteArchivo++; i < archivos.size(); i = siguienteArchivo++) {
+            const std::string& ruta = archivos[i];
+            auto inicio = Reloj::now();
+
+            std::ifstream file(ruta);
+            if (!file.is_open()) {
+                registrarError(ruta + ": no se pudo abrir");
+                continue;
+            }
+            std::string contenido((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            Leida leida;
+            leida.salida = (fs::path(config.dirSalida) / fs::path(ruta).stem()).string() + extension;
+            leida.data = JsonUtils::leerFormulaJsonTexto(contenido);
+            std::string error = leida.data.error;
+            int m = (int)std::min<size_t>(leida.data.clausulas.size(), INT32_MAX);
+            bool valida = leida.data.exito && JsonUtils::literalesValidos(leida.data, error) &&
+                          instanciaAbarcable(leida.data.numVars, m, config.opciones.basura, config.maxTripletas, error);
+
+            lectura.bytes += contenido.size();
+            lectura.nanosOcupada += nanosDesde(inicio);
+            if (!valida) {
+                registrarError(ruta + ": " + error);
+                continue;
+            }
+            ++lectura.elementos;
+            if (!ponerMidiendo(colaReduccion, std::move(leida), lectura)) break;
+        }
+    };
+
+    auto trabajoReduccion = [&]() {
+        Leida leida;
+        while (colaReduccion.extraer(leida)) {
+            auto inicio = Reloj::now();
+            Serializada s;
+            s.salida = std::move(leida.salida);
+            try {
+                Reduccion3SATto3DM r(leida.data.numVars, leida.data.clausulas, config.opciones);
+                r.generar();
+
+                if (config.compacto) {
+                    auto datos = CodificadorCompacto::codificar(r.getNumVariables(), r.getNumClausulas(),
+                                                                r.getTripletasCompactas());
+                    s.contenido.assign(datos.begin(), datos.end());
+                } else {
+                    std::ostringstream out;
+                    JsonUtils::escribirResultadoJson(out, r.getTripletas(),
+                                                     tamanoMatchingPerfecto(r.getNumVariables(), r.getNumClausulas()));
+                    s.contenido = out.str();
+                }
+            } catch (const std::bad_alloc&) {
+                registrarError(s.salida + ": memoria insuficiente");
+                continue;
+            } catch (const std::length_error&) {
+                registrarError(s.salida + ": memoria insuficiente");
+                continue;
+            }
+
+            reduccion.bytes += s.contenido.size();
+            reduccion.nanosOcupada += nanosDesde(inicio);
+            ++reduccion.elementos;
+            if (!ponerMidiendo(colaEscritura, std::move(s), reduccion)) break;
+        }
+    };
+
+    auto trabajoEscritura = [&]() {
+        Serializada s;
+        while (colaEscritura.extraer(s)) {
+            auto inicio = Reloj::now();
+            std::ofstream out(s.salida, std::ios::binary);
+            out.write(s.contenido.data(), (std::streamsize)s.contenido.size());
+            out.close();
+            escritura.nanosOcupada += nanosDesde(inicio);
+
+            if (!out) {
+                registrarError(s.salida + ": error al escribir");
+                continue;
+            }
+            escritura.bytes += s.contenido.size();
+            ++escritura.elementos;
+            ++correctos;
+        }
+    };
+
+    auto inicio = Reloj::now();
+    std::vector<std::thread> hilos;
+    lanzarEtapa<Leida>(hilos, std::max(1u, config.lectores), trabajoLectura, &colaReduccion);
+    lanzarEtapa<Serializada>(hilos, reductores, trabajoReduccion, &colaEscritura);
+    lanzarEtapa<Serializada>(hilos, std::max(1u, config.escritores), trabajoEscritura, nullptr);
+    for (auto& t : hilos) {
+        t.join();
+    }
+
+    resultado.segundos = nanosDesde(inicio) / 1e9;
+    resultado.correctos = correctos;
+    resultado.lectura = lectura.valor();
+    resultado.reduccion = reduccion.valor();
+    resultado.escritura = escritura.valor();
+    return resultado;
+}
@@ -0,0 +1,302 @@
+/**
+ * @file Recuperacion.cpp
+ * @brief Implementación de la reducción inversa (matching → asignación)
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Recuperacion.h"
+#include "JsonUtils.h"
+#include "NucleoReduccion.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+const char MAGICO[4] = {'3', 'D', 'M', 'M'};
+const uint8_t VERSION_MATCHING = 1;
+const uint64_t CABECERA_MATCHING = 4 + 1 + sizeof(uint64_t);
+const size_t POSICIONES_BLOQUE = 1 << 13;
+
+// Enteros en little-endian, como en el protocolo del servicio
+uint64_t leerU64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+void ponerU64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+int literalDe(const Clausula& c, int i) {
+    return i == 0 ? c.l1 : i == 1 ? c.l2 : c.l3;
+}
+
+bool literalCierto(int literal, int n, const std::vector<bool>& asignacion) {
+    int v = std::abs(literal);
+    return v >= 1 && v <= n && asignacion[v] == (literal > 0);
+}
+
+bool esMatchingBinario(const uint8_t* datos, uint64_t tam) {
+    return tam >= 4 && std::memcmp(datos, MAGICO, 4) == 0;
+}
+
+// Cabecera de un matching binario de 'tam' bytes en total; el número de
+// posiciones debe cuadrar con el tamaño antes de reservar nada
+bool leerCabecera(const uint8_t* datos, uint64_t tam, uint64_t& cuenta, std::string& error) {
+    if (tam < CABECERA_MATCHING || datos[4] != VERSION_MATCHING) {
+        error = "cabecera de matching inválida";
+        return false;
+    }
+    cuenta = leerU64(datos + 5);
+    const uint64_t restantes = tam - CABECERA_MATCHING;
+    if (cuenta > restantes / sizeof(uint64_t) || cuenta * sizeof(uint64_t) != restantes) {
+        error = "el archivo no tiene las " + std::to_string(cuenta) + " posiciones que indica la cabecera";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+OrigenTripleta origenTripleta(int n, Vista<Clausula> formula, uint64_t p, VarianteBasura basura) {
+    OrigenTripleta o;
+    const int m = (int)formula.size();
+    if (n <= 0 || m <= 0 || p >= numTripletas(n, m, basura)) return o;
+    const uint64_t anillos = numTripletasAnillos(n, m);
+    const uint64_t clausulas = anillos + numTripletasClausulas(m);
+
+    if (p < anillos) {
+        // 2·m tripletas por variable; en cada etapa, primero True y después False
+        o.tipo = OrigenTripleta::ANILLO;
+        o.variable = (int)(p / (2 * (uint64_t)m)) + 1;
+        o.etapa = (int)(p % (2 * (uint64_t)m) / 2);
+        o.valor = p % 2 == 0;
+        uint32_t nodo = idNodoAnillo(o.variable, o.etapa, m);
+        o.tripleta = o.valor ? TripletaCompacta{idTip(o.variable, o.etapa, true, m), nodo, nodo}
+                             : TripletaCompacta{idTip(o.variable, o.etapa, false, m),
+                                                idNodoAnillo(o.variable, (o.etapa + 1) % m, m), nodo};
+    } else if (p < clausulas) {
+        // Tres tripletas por cláusula, una por literal
+        const uint64_t q = p - anillos;
+        const int literal = literalDe(formula[q / 3], (int)(q % 3));
+        o.tipo = OrigenTripleta::CLAUSULA;
+        o.variable = std::abs(literal);
+        o.etapa = (int)(q / 3);
+        o.valor = literal > 0;
+        uint32_t nodo = idNodoClausula(o.etapa, n, m);
+        o.tripleta = TripletaCompacta{idTip(o.variable, o.etapa, literal < 0, m), nodo, nodo};
+    } else {
+        // Cada par recorre sus tips en orden: los 2·n·m, o los 2·n de su etapa
+        const uint64_t q = p - clausulas;
+        const uint64_t porPar = basura == BASURA_POR_ETAPA ? 2 * (uint64_t)n : tamanoDimension(n, m);
+        const uint64_t k = q / porPar, r = q % porPar;
+        uint32_t w = basura == BASURA_POR_ETAPA ? idTip((int)(r / 2) + 1, (int)(k / (n - 1)), r % 2 == 1, m)
+                                                : (uint32_t)r;
+        o.tipo = OrigenTripleta::BASURA;
+        o.variable = (int)(w / 2 / (uint32_t)m) + 1;
+        o.etapa = (int)(w / 2 % (uint32_t)m);
+        o.valor = w % 2 == 0;
+        uint32_t g = idNodoBasura((int)k, n, m);
+        o.tripleta = TripletaCompacta{w, g, g};
+    }
+    return o;
+}
+
+ResultadoRecuperacion recuperarAsignacion(int n, Vista<Clausula> formula, Vista<uint64_t> matching,
+                                          VarianteBasura basura, unsigned hilos) {
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoRecuperacion r;
+    const int m = (int)formula.size();
+    r.tripletas = matching.size();
+    if (n <= 0 || m <= 0 || tamanoDimension(n, m) > UINT32_MAX) return r;
+    r.asignacion.assign(n + 1, false);
+    const uint64_t d = tamanoDimension(n, m);
+
+    // Opciones elegidas en cada etapa de cada anillo: bit 1 True, bit 2 False
+    std::vector<uint8_t> opciones((size_t)n * m, 0);
+    std::vector<uint8_t> cubierto(3 * d, 0);
+    for (uint64_t p : matching) {
+        OrigenTripleta o = origenTripleta(n, formula, p, basura);
+        if (o.tipo == OrigenTripleta::FUERA_DE_RANGO) {
+            ++r.fueraDeRango;
+            continue;
+        }
+        uint8_t& w = cubierto[o.tripleta.w];
+        uint8_t& x = cubierto[d + o.tripleta.x];
+        uint8_t& y = cubierto[2 * d + o.tripleta.y];
+        if (w | x | y) ++r.solapadas;
+        w = x = y = 1;
+        if (o.tipo == OrigenTripleta::ANILLO) {
+            opciones[(size_t)(o.variable - 1) * m + o.etapa] |= o.valor ? 1 : 2;
+        }
+    }
+    uint64_t cubiertos = 0;
+    for (uint8_t c : cubierto) cubiertos += c;
+    r.sinCubrir = 3 * d - cubiertos;
+
+    // Un anillo es coherente si todas sus etapas eligieron la misma única opción
+    for (int v = 1; v <= n; ++v) {
+        const uint8_t* etapas = opciones.data() + (size_t)(v - 1) * m;
+        uint8_t primera = 0;
+        bool coherente = etapas[0] == 1 || etapas[0] == 2;
+        for (int j = 0; j < m; ++j) {
+            coherente = coherente && etapas[j] == etapas[0];
+            if (!primera) primera = etapas[j];
+        }
+        r.asignacion[v] = (primera & 1) != 0;
+        r.variablesIncoherentes += !coherente;
+    }
+
+    hilos = hilosPara((uint64_t)m, hilos);
+    std::vector<uint64_t> falsas(hilos, 0);
+    std::vector<int> primeraFalsa(hilos, 0);
+    enParalelo(hilos, [&](unsigned h) {
+        uint64_t cuenta = 0;
+        int primera = 0;
+        for (uint64_t j = (uint64_t)m * h / hilos; j < (uint64_t)m * (h + 1) / hilos; ++j) {
+            const Clausula& c = formula[j];
+            if (literalCierto(c.l1, n, r.asignacion) || literalCierto(c.l2, n, r.asignacion) ||
+                literalCierto(c.l3, n, r.asignacion)) {
+                continue;
+            }
+            if (cuenta++ == 0) primera = (int)j + 1;
+        }
+        falsas[h] = cuenta;
+        primeraFalsa[h] = primera;
+    });
+    for (unsigned h = 0; h < hilos; ++h) {
+        r.clausulasFalsas += falsas[h];
+        if (!r.primeraClausulaFalsa) r.primeraClausulaFalsa = primeraFalsa[h];
+    }
+
+    r.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return r;
+}
+
+std::vector<uint64_t> construirMatching(int n, Vista<Clausula> formula, const std::vector<bool>& asignacion,
+                                        VarianteBasura basura) {
+    std::vector<uint64_t> matching;
+    const int m = (int)formula.size();
+    if (n <= 0 || m <= 0 || tamanoDimension(n, m) > UINT32_MAX || asignacion.size() != (size_t)n + 1) {
+        return matching;
+    }
+    const uint64_t anillos = numTripletasAnillos(n, m);
+    const uint64_t clausulas = anillos + numTripletasClausulas(m);
+    matching.reserve(tamanoMatchingPerfecto(n, m));
+
+    // Anillos: en cada etapa, la opción True o la False de la variable
+    for (int v = 1; v <= n; ++v) {
+        for (int j = 0; j < m; ++j) {
+            matching.push_back(2 * (uint64_t)m * (v - 1) + 2 * (uint64_t)j + (asignacion[v] ? 0 : 1));
+        }
+    }
+
+    // Cláusulas: el primer literal cierto toma el tip libre de su variable en la etapa j
+    std::vector<uint8_t> tomado((size_t)n * m, 0);
+    for (int j = 0; j < m; ++j) {
+        int elegido = 0;
+        while (elegido < 3 && !literalCierto(literalDe(formula[j], elegido), n, asignacion)) ++elegido;
+        if (elegido == 3) return {};
+        matching.push_back(anillos + 3 * (uint64_t)j + elegido);
+        tomado[(size_t)(std::abs(literalDe(formula[j], elegido)) - 1) * m + j] = 1;
+    }
+
+    // Basura: un par para cada tip libre que no ha tomado ninguna cláusula
+    uint64_t k = 0;
+    if (basura == BASURA_POR_ETAPA) {
+        for (int j = 0; j < m; ++j) {
+            for (int v = 1; v <= n; ++v) {
+                if (tomado[(size_t)(v - 1) * m + j]) continue;
+                matching.push_back(clausulas + k++ * 2 * n + 2 * (uint64_t)(v - 1) + (asignacion[v] ? 0 : 1));
+            }
+        }
+    } else {
+        for (int v = 1; v <= n; ++v) {
+            for (int j = 0; j < m; ++j) {
+                if (tomado[(size_t)(v - 1) * m + j]) continue;
+                matching.push_back(clausulas + k++ * tamanoDimension(n, m) + idTip(v, j, !asignacion[v], m));
+            }
+        }
+    }
+    return matching;
+}
+
+bool decodificarMatching(const std::vector<uint8_t>& datos, std::vector<uint64_t>& matching, std::string& error) {
+    matching.clear();
+    if (!esMatchingBinario(datos.data(), datos.size())) {
+        return JsonUtils::leerIndicesJsonTexto(std::string(datos.begin(), datos.end()), matching, error);
+    }
+    uint64_t cuenta;
+    if (!leerCabecera(datos.data(), datos.size(), cuenta, error)) return false;
+    matching.resize(cuenta);
+    for (uint64_t i = 0; i < cuenta; ++i) {
+        matching[i] = leerU64(datos.data() + CABECERA_MATCHING + i * sizeof(uint64_t));
+    }
+    return true;
+}
+
+bool leerMatching(const std::string& filepath, std::vector<uint64_t>& matching, std::string& error) {
+    matching.clear();
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        error = "no se pudo abrir " + filepath;
+        return false;
+    }
+    const uint64_t tamArchivo = (uint64_t)file.tellg();
+    file.seekg(0);
+    std::vector<uint8_t> datos(std::min<uint64_t>(tamArchivo, CABECERA_MATCHING));
+    file.read(reinterpret_cast<char*>(datos.data()), (std::streamsize)datos.size());
+
+    if (!esMatchingBinario(datos.data(), datos.size())) {
+        const uint64_t leidos = datos.size();
+        datos.resize(tamArchivo);
+        file.read(reinterpret_cast<char*>(datos.data()) + leidos, (std::streamsize)(tamArchivo - leidos));
+        return decodificarMatching(datos, matching, error);
+    }
+
+    // En binario las posiciones se leen directamente en el vector, sin copia
+    // intermedia, y se pasan al orden de bytes de la máquina en su sitio
+    uint64_t cuenta;
+    if (!leerCabecera(datos.data(), tamArchivo, cuenta, error)) return false;
+    matching.resize(cuenta);
+    if (!file.read(reinterpret_cast<char*>(matching.data()), (std::streamsize)(cuenta * sizeof(uint64_t)))) {
+        matching.clear();
+        error = "no se pudo leer " + filepath;
+        return false;
+    }
+    for (auto& p : matching) {
+        uint8_t bytes[sizeof(uint64_t)];
+        std::memcpy(bytes, &p, sizeof(bytes));
+        p = leerU64(bytes);
+    }
+    return true;
+}
+
+bool guardarMatching(const std::string& filepath, const std::vector<uint64_t>& matching) {
+    if (filepath.size() >= 5 && filepath.compare(filepath.size() - 5, 5, ".json") == 0) {
+        return JsonUtils::guardarIndicesJson(filepath, matching);
+    }
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    uint8_t cabecera[CABECERA_MATCHING];
+    std::memcpy(cabecera, MAGICO, 4);
+    cabecera[4] = VERSION_MATCHING;
+    ponerU64(cabecera + 5, matching.size());
+    file.write(reinterpret_cast<const char*>(cabecera), sizeof(cabecera));
+
+    // Las posiciones se codifican por bloques, sin copiar todo el matching
+    std::vector<uint8_t> bloque(POSICIONES_BLOQUE * sizeof(uint64_t));
+    for (size_t inicio = 0; inicio < matching.size(); inicio += POSICIONES_BLOQUE) {
+        const size_t cuenta = std::min(POSICIONES_BLOQUE, matching.size() - inicio);
+        for (size_t i = 0; i < cuenta; ++i) ponerU64(bloque.data() + i * sizeof(uint64_t), matching[inicio + i]);
+        file.write(reinterpret_cast<const char*>(bloque.data()), (std::streamsize)(cuenta * sizeof(uint64_t)));
+    }
+    return (bool)file.flush();
+}
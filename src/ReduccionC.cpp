@@ -0,0 +1,74 @@
+/**
+ * @file ReduccionC.cpp
+ * @brief Implementación de la interfaz C de la reducción
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "ReduccionC.h"
+#include "Reduccion3SATto3DM.h"
+#include "NucleoReduccion.h"
+#include <new>
+#include <stdexcept>
+
+// Las cláusulas y tripletas se reinterpretan sin copiarlas
+static_assert(sizeof(Clausula) == 3 * sizeof(int), "Clausula debe ser int[3]");
+static_assert(sizeof(r3dm_tripleta) == sizeof(TripletaCompacta), "r3dm_tripleta debe coincidir con TripletaCompacta");
+
+struct r3dm_instancia {
+    Reduccion3SATto3DM reduccion;
+
+    r3dm_instancia(int numVars, Vista<Clausula> formula) : reduccion(numVars, formula) {}
+};
+
+r3dm_estado r3dm_reducir(int num_vars, const int* literales, size_t num_clausulas,
+                         r3dm_instancia** salida) {
+    if (!salida || !literales || num_vars <= 0 || num_clausulas == 0) {
+        return R3DM_ERROR_ARGUMENTO;
+    }
+    *salida = nullptr;
+
+    // Mismo límite que la CLI y el servicio, antes de leer los literales
+    std::string error;
+    if (num_clausulas > (size_t)INT32_MAX ||
+        !instanciaAbarcable(num_vars, (int)num_clausulas, BASURA_COMPLETA, LIMITE_TRIPLETAS, error)) {
+        return R3DM_ERROR_TAMANO;
+    }
+
+    // Sin std::abs: abs(INT_MIN) no está definido
+    for (size_t i = 0; i < 3 * num_clausulas; ++i) {
+        if (literales[i] == 0 || literales[i] < -num_vars || literales[i] > num_vars) {
+            return R3DM_ERROR_LITERAL;
+        }
+    }
+
+    Vista<Clausula> formula(reinterpret_cast<const Clausula*>(literales), num_clausulas);
+    try {
+        auto* instancia = new r3dm_instancia(num_vars, formula);
+        instancia->reduccion.generar();
+        *salida = instancia;
+    } catch (const std::bad_alloc&) {
+        return R3DM_ERROR_MEMORIA;
+    } catch (const std::length_error&) {
+        return R3DM_ERROR_MEMORIA;
+    }
+    return R3DM_OK;
+}
+
+size_t r3dm_num_tripletas(const r3dm_instancia* instancia) {
+    return instancia ? instancia->reduccion.getTripletasCompactas().size() : 0;
+}
+
+const r3dm_tripleta* r3dm_tripletas(const r3dm_instancia* instancia) {
+    if (!instancia) return nullptr;
+    return reinterpret_cast<const r3dm_tripleta*>(instancia->reduccion.getTripletasCompactas().data());
+}
+
+uint64_t r3dm_tamano_dimension(const r3dm_instancia* instancia) {
+    if (!instancia) return 0;
+    return tamanoDimension(instancia->reduccion.getNumVariables(), instancia->reduccion.getNumClausulas());
+}
+
+void r3dm_liberar(r3dm_instancia* instancia) {
+    delete instancia;
+}
@@ -0,0 +1,316 @@
+/**
+ * @file Servicio.cpp
+ * @brief Implementación del servicio de reducción sobre socket Unix
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Servicio.h"
+#include "ColaAcotada.h"
+#include "CodificadorCompacto.h"
+#include "JsonUtils.h"
+#include "NucleoReduccion.h"
+#include "Reduccion3SATto3DM.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+std::atomic<bool> detener{false};
+
+void manejarSenal(int) {
+    detener = true;
+}
+
+bool leerExacto(int fd, void* buffer, size_t n) {
+    char* p = static_cast<char*>(buffer);
+    while (n > 0) {
+        ssize_t leidos = read(fd, p, n);
+        if (leidos < 0 && errno == EINTR) continue;
+        if (leidos <= 0) return false;
+        p += leidos;
+        n -= (size_t)leidos;
+    }
+    return true;
+}
+
+bool escribirExacto(int fd, const void* buffer, size_t n) {
+    const char* p = static_cast<const char*>(buffer);
+    while (n > 0) {
+        ssize_t escritos = send(fd, p, n, MSG_NOSIGNAL);
+        if (escritos < 0 && errno == EINTR) continue;
+        if (escritos <= 0) return false;
+        p += escritos;
+        n -= (size_t)escritos;
+    }
+    return true;
+}
+
+uint32_t leerU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void ponerU32(std::string& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back((char)((v >> (8 * i)) & 0xff));
+}
+
+// Envía una trama: u32 longitud | u32 id | u8 cabecera | carga
+bool enviarTrama(int fd, uint32_t id, uint8_t cabecera, const std::string& carga) {
+    std::string trama;
+    trama.reserve(9 + carga.size());
+    ponerU32(trama, (uint32_t)(5 + carga.size()));
+    ponerU32(trama, id);
+    trama.push_back((char)cabecera);
+    trama += carga;
+    return escribirExacto(fd, trama.data(), trama.size());
+}
+
+// Recibe una trama; 'maximo' limita la longitud aceptada
+bool recibirTrama(int fd, size_t maximo, uint32_t& id, uint8_t& cabecera, std::string& carga) {
+    uint8_t cab[9];
+    if (!leerExacto(fd, cab, 4)) return false;
+    uint32_t longitud = leerU32(cab);
+    if (longitud < 5 || longitud > maximo) return false;
+    if (!leerExacto(fd, cab + 4, 5)) return false;
+    id = leerU32(cab + 4);
+    cabecera = cab[8];
+    carga.resize(longitud - 5);
+    return carga.empty() || leerExacto(fd, &carga[0], carga.size());
+}
+
+struct Conexion {
+    int fd;
+    std::mutex escritura; // Las respuestas de varios hilos no deben mezclarse
+
+    explicit Conexion(int descriptor) : fd(descriptor) {}
+    ~Conexion() { close(fd); }
+
+    void responder(uint32_t id, uint8_t estado, const std::string& carga) {
+        std::lock_guard<std::mutex> lock(escritura);
+        enviarTrama(fd, id, estado, carga);
+    }
+};
+
+struct Peticion {
+    std::shared_ptr<Conexion> conexion;
+    uint32_t id;
+    uint8_t formato;
+    std::string formula;
+};
+
+// Reduce la fórmula de la petición y serializa el resultado en el formato pedido
+// (una petición demasiado grande o sin memoria se responde con ESTADO_ERROR, sin detener el servicio)
+std::string procesarPeticion(const Peticion& p, uint64_t maxTripletas, uint8_t& estado) {
+    estado = ESTADO_ERROR;
+    JsonUtils::FormulaData data = JsonUtils::leerFormulaJsonTexto(p.formula);
+    if (!data.exito) {
+        return "Fórmula JSON inválida: " + data.error;
+    }
+    std::string error;
+    if (!JsonUtils::literalesValidos(data, error)) {
+        return error;
+    }
+    if (!instanciaAbarcable(data.numVars, (int)data.clausulas.size(), BASURA_COMPLETA, maxTripletas, error)) {
+        return "Fórmula rechazada: " + error;
+    }
+
+    try {
+        Reduccion3SATto3DM reduccion(data.numVars, data.clausulas);
+        reduccion.generar();
+
+        std::string carga;
+        if (p.formato == FORMATO_COMPACTO) {
+            auto datos = CodificadorCompacto::codificar(reduccion.getNumVariables(), reduccion.getNumClausulas(),
+                                                        reduccion.getTripletasCompactas());
+            carga.assign(datos.begin(), datos.end());
+        } else {
+            std::ostringstream out;
+            JsonUtils::escribirResultadoJson(out, reduccion.getTripletas(),
+                                             tamanoMatchingPerfecto(data.numVars, (int)data.clausulas.size()));
+            carga = out.str();
+        }
+        estado = ESTADO_OK;
+        return carga;
+    } catch (const std::bad_alloc&) {
+        return "Memoria insuficiente para reducir la fórmula";
+    } catch (const std::length_error&) {
+        return "Memoria insuficiente para reducir la fórmula";
+    }
+}
+
+// Conexiones abiertas, para poder cortarlas al detener el servicio
+class RegistroConexiones {
+private:
+    std::mutex mtx;
+    std::condition_variable vacio;
+    std::set<std::shared_ptr<Conexion>> activas;
+
+public:
+    void agregar(const std::shared_ptr<Conexion>& c) {
+        std::lock_guard<std::mutex> lock(mtx);
+        activas.insert(c);
+    }
+
+    void quitar(const std::shared_ptr<Conexion>& c) {
+        std::lock_guard<std::mutex> lock(mtx);
+        activas.erase(c);
+        if (activas.empty()) vacio.notify_all();
+    }
+
+    // Deja de leer de todas las conexiones (las respuestas pendientes aún se envían)
+    void cerrarLecturas() {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (const auto& c : activas) shutdown(c->fd, SHUT_RD);
+    }
+
+    void esperarVacio() {
+        std::unique_lock<std::mutex> lock(mtx);
+        vacio.wait(lock, [&] { return activas.empty(); });
+    }
+};
+
+void atenderConexion(std::shared_ptr<Conexion> conexion, ColaAcotada<Peticion>& cola,
+                     RegistroConexiones& registro, size_t tamanoMaximo) {
+    Peticion p;
+    while (recibirTrama(conexion->fd, tamanoMaximo, p.id, p.formato, p.formula)) {
+        if (p.formato != FORMATO_JSON && p.formato != FORMATO_COMPACTO) {
+            conexion->responder(p.id, ESTADO_ERROR, "Formato desconocido");
+            continue;
+        }
+        p.conexion = conexion;
+        if (!cola.poner(std::move(p))) break;
+        p = Peticion();
+    }
+    registro.quitar(conexion);
+}
+
+int abrirSocketEscucha(const std::string& ruta) {
+    sockaddr_un dir{};
+    if (ruta.size() >= sizeof(dir.sun_path)) {
+        std::cerr << "❌ Ruta de socket demasiado larga: " << ruta << "\n";
+        return -1;
+    }
+    dir.sun_family = AF_UNIX;
+    std::strncpy(dir.sun_path, ruta.c_str(), sizeof(dir.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    unlink(ruta.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr*>(&dir), sizeof(dir)) < 0 || listen(fd, 128) < 0) {
+        std::cerr << "❌ No se pudo escuchar en " << ruta << ": " << std::strerror(errno) << "\n";
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace
+
+int ejecutarServicio(const ConfiguracionServicio& config) {
+    int escucha = abrirSocketEscucha(config.rutaSocket);
+    if (escucha < 0) return 1;
+
+    struct sigaction accion{};
+    accion.sa_handler = manejarSenal;
+    sigemptyset(&accion.sa_mask);
+    sigaction(SIGINT, &accion, nullptr);
+    sigaction(SIGTERM, &accion, nullptr);
+
+    unsigned hilos = config.hilos ? config.hilos : std::max(1u, std::thread::hardware_concurrency());
+    ColaAcotada<Peticion> cola(config.capacidadCola);
+    RegistroConexiones registro;
+
+    // Hilos de reducción: cada uno toma lotes de peticiones de la cola
+    std::vector<std::thread> trabajadores;
+    for (unsigned h = 0; h < hilos; ++h) {
+        trabajadores.emplace_back([&]() {
+            std::vector<Peticion> lote;
+            auto peso = [](const Peticion& p) { return p.formula.size(); };
+            while (cola.extraerLote(lote, config.tamanoLote, config.bytesLote, peso)) {
+                for (const auto& p : lote) {
+                    uint8_t estado;
+                    std::string carga = procesarPeticion(p, config.maxTripletas, estado);
+                    p.conexion->responder(p.id, estado, carga);
+                }
+            }
+        });
+    }
+
+    std::cout << "✓ Servicio escuchando en " << config.rutaSocket << " (" << hilos << " hilos)\n";
+
+    while (!detener) {
+        pollfd pfd{escucha, POLLIN, 0};
+        int listo = poll(&pfd, 1, 200);
+        if (listo <= 0) continue;
+
+        int fd = accept(escucha, nullptr, nullptr);
+        if (fd < 0) continue;
+
+        auto conexion = std::make_shared<Conexion>(fd);
+        registro.agregar(conexion);
+        std::thread(atenderConexion, conexion, std::ref(cola), std::ref(registro),
+                    config.tamanoMaximoPeticion).detach();
+    }
+
+    // Parada ordenada: no se aceptan más peticiones y se responden las pendientes
+    close(escucha);
+    registro.cerrarLecturas();
+    registro.esperarVacio();
+    cola.cerrar();
+    for (auto& t : trabajadores) {
+        t.join();
+    }
+    unlink(config.rutaSocket.c_str());
+
+    std::cout << "✓ Servicio detenido\n";
+    return 0;
+}
+
+bool enviarPeticiones(const std::string& rutaSocket, const std::string& formulaJson, uint8_t formato,
+                      unsigned repeticiones, std::string& respuesta, double& segundosPorPeticion) {
+    sockaddr_un dir{};
+    if (rutaSocket.size() >= sizeof(dir.sun_path)) return false;
+    dir.sun_family = AF_UNIX;
+    std::strncpy(dir.sun_path, rutaSocket.c_str(), sizeof(dir.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    if (connect(fd, reinterpret_cast<sockaddr*>(&dir), sizeof(dir)) < 0) {
+        close(fd);
+        return false;
+    }
+
+    bool ok = true;
+    auto inicio = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < repeticiones && ok; ++i) {
+        uint32_t id;
+        uint8_t estado;
+        ok = enviarTrama(fd, i, formato, formulaJson) &&
+             recibirTrama(fd, UINT32_MAX, id, estado, respuesta) &&
+             id == i && estado == ESTADO_OK;
+    }
+    auto fin = std::chrono::steady_clock::now();
+    close(fd);
+
+    segundosPorPeticion = repeticiones ? std::chrono::duration<double>(fin - inicio).count() / repeticiones : 0.0;
+    return ok;
+}
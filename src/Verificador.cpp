@@ -0,0 +1,308 @@
+/**
+ * @file Verificador.cpp
+ * @brief Implementación de las pruebas diferenciales y del arnés de fuzzing
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Verificador.h"
+#include "Analisis.h"
+#include "CodificadorCompacto.h"
+#include "GeneradorFormulas.h"
+#include "IndiceTripletas.h"
+#include "JsonUtils.h"
+#include "NucleoReduccion.h"
+#include "Paralelo.h"
+#include "Recuperacion.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+
+namespace {
+
+// Discrepancias que se guardan con su descripción
+constexpr size_t MAX_DISCREPANCIAS = 10;
+
+// Límites del arnés para no perder el tiempo en instancias grandes
+constexpr int FUZZ_MAX_VARIABLES = 5;
+constexpr int FUZZ_MAX_CLAUSULAS = 5;
+// Las codificaciones compactas se limitan por tripletas, no por n y m: una
+// instancia con pocas tripletas y dimensiones enormes también debe probarse
+constexpr uint64_t FUZZ_MAX_TRIPLETAS = 1 << 16;
+
+bool literalCierto(int literal, uint32_t asignacion) {
+    bool valor = (asignacion >> (std::abs(literal) - 1)) & 1;
+    return literal > 0 ? valor : !valor;
+}
+
+// Cobertura exacta sobre el índice por elementos
+class BuscadorMatching {
+private:
+    Vista<TripletaCompacta> M;
+    IndiceTripletas indice;
+    uint64_t d = 0;
+    std::vector<uint8_t> cubierto;
+    uint64_t pendientes = 0;
+    std::vector<uint64_t> elegidas;
+
+    bool libre(uint32_t i) const {
+        const TripletaCompacta& t = M[i];
+        return !cubierto[t.w] && !cubierto[d + t.x] && !cubierto[2 * d + t.y];
+    }
+
+    void marcar(uint32_t i, uint8_t valor) {
+        const TripletaCompacta& t = M[i];
+        cubierto[t.w] = cubierto[d + t.x] = cubierto[2 * d + t.y] = valor;
+        pendientes = valor ? pendientes - 3 : pendientes + 3;
+        if (valor) elegidas.push_back(i);
+        else elegidas.pop_back();
+    }
+
+public:
+    explicit BuscadorMatching(const InstanciaVista& instancia) : M(instancia.tripletas) {
+        if (!indice.construir(instancia, 1)) return;
+        d = indice.tamanoDimension();
+        cubierto.assign(3 * d, 0);
+        pendientes = 3 * d;
+    }
+
+    bool buscar() {
+        if (pendientes == 0) return true;
+
+        // Elemento sin cubrir con menos tripletas libres
+        uint64_t mejor = 0;
+        size_t opciones = SIZE_MAX;
+        for (uint64_t e = 0; e < cubierto.size() && opciones > 1; ++e) {
+            if (cubierto[e]) continue;
+            size_t libres = 0;
+            for (uint32_t i : indice.deGlobal(e)) libres += libre(i);
+            if (libres < opciones) {
+                opciones = libres;
+                mejor = e;
+            }
+        }
+        if (opciones == 0) return false;
+
+        for (uint32_t i : indice.deGlobal(mejor)) {
+            if (!libre(i)) continue;
+            marcar(i, 1);
+            if (buscar()) return true;
+            marcar(i, 0);
+        }
+        return false;
+    }
+
+    const std::vector<uint64_t>& matching() const { return elegidas; }
+};
+
+// Fórmula con n variables y m cláusulas, literales sin restricciones
+std::vector<Clausula> formulaPrueba(int n, int m, GeneradorAleatorio& g) {
+    auto literal = [&]() {
+        int v = 1 + (int)g.uniforme((uint32_t)n);
+        return g.moneda() ? -v : v;
+    };
+    std::vector<Clausula> formula(m);
+    for (auto& c : formula) {
+        c.l1 = literal();
+        c.l2 = literal();
+        c.l3 = literal();
+    }
+    return formula;
+}
+
+std::string describirFormula(int n, const std::vector<Clausula>& formula) {
+    std::string s = "n=" + std::to_string(n) + " [";
+    for (size_t j = 0; j < formula.size(); ++j) {
+        const Clausula& c = formula[j];
+        s += (j ? ", [" : "[") + std::to_string(c.l1) + ", " + std::to_string(c.l2) + ", " +
+             std::to_string(c.l3) + "]";
+    }
+    return s + "]";
+}
+
+void comprobar(bool condicion) {
+    if (!condicion) std::abort();
+}
+
+} // namespace
+
+bool satisfacibleFuerzaBruta(int n, Vista<Clausula> formula, std::vector<bool>* asignacion) {
+    if (n <= 0 || n > 24) return false;
+    for (uint32_t bits = 0; bits < (1u << n); ++bits) {
+        bool todas = true;
+        for (const auto& c : formula) {
+            if (!literalCierto(c.l1, bits) && !literalCierto(c.l2, bits) &&
+                !literalCierto(c.l3, bits)) {
+                todas = false;
+                break;
+            }
+        }
+        if (todas) {
+            if (asignacion) {
+                asignacion->assign(n + 1, false);
+                for (int v = 1; v <= n; ++v) (*asignacion)[v] = (bits >> (v - 1)) & 1;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool tieneMatchingPerfecto(const InstanciaVista& instancia, std::vector<uint64_t>* matching) {
+    if (instancia.n <= 0 || instancia.m <= 0) return false;
+    BuscadorMatching buscador(instancia);
+    if (!buscador.buscar()) return false;
+    if (matching) *matching = buscador.matching();
+    return true;
+}
+
+bool verificarFormula(int n, const std::vector<Clausula>& formula, std::string& discrepancia) {
+    const int m = (int)formula.size();
+    std::vector<bool> asignacion;
+    const bool satisfacible = satisfacibleFuerzaBruta(n, formula, &asignacion);
+
+    for (VarianteBasura basura : {BASURA_COMPLETA, BASURA_POR_ETAPA}) {
+        for (bool sinDuplicados : {false, true}) {
+            OpcionesReduccion opciones;
+            opciones.basura = basura;
+            opciones.eliminarDuplicadas = sinDuplicados;
+            Reduccion3SATto3DM reduccion(n, formula, opciones);
+            reduccion.generar();
+            const std::vector<TripletaCompacta>& M = reduccion.getTripletasCompactas();
+            InstanciaVista instancia{n, m, M};
+
+            std::string caso = std::string(basura == BASURA_COMPLETA ? "basura completa" : "basura por etapa") +
+                               (sinDuplicados ? ", sin duplicadas" : "") + ": ";
+            auto fallar = [&](const std::string& motivo) {
+                discrepancia = caso + motivo + " en " + describirFormula(n, formula);
+                return false;
+            };
+
+            if (M.size() + reduccion.getDuplicadasEliminadas() != numTripletas(n, m, basura)) {
+                return fallar(std::to_string(M.size()) + " tripletas, se esperaban " +
+                              std::to_string(numTripletas(n, m, basura)));
+            }
+
+            EstadisticasInstancia e = analizarInstancia(instancia, 1);
+            if (e.fueraDeRango > 0 || e.w.usados != e.w.elementos || e.x.usados != e.x.elementos ||
+                e.y.usados != e.y.elementos || (sinDuplicados && e.duplicadas > 0)) {
+                return fallar("instancia mal formada");
+            }
+
+            int nLeido = 0, mLeido = 0;
+            std::vector<TripletaCompacta> decodificadas;
+            if (!CodificadorCompacto::decodificar(CodificadorCompacto::codificar(n, m, M), M.size(), nLeido, mLeido,
+                                              decodificadas) ||
+                nLeido != n || mLeido != m || decodificadas != M) {
+                return fallar("la ida y vuelta por el formato compacto no coincide");
+            }
+
+            std::vector<uint64_t> matching;
+            if (tieneMatchingPerfecto(instancia, &matching) != satisfacible) {
+                return fallar(satisfacible ? "fórmula satisfacible sin matching perfecto"
+                                           : "fórmula insatisfacible con matching perfecto");
+            }
+            if (sinDuplicados) continue;
+
+            // Reducción inversa: las posiciones de M se interpretan sin mirar M
+            for (uint64_t p = 0; p < M.size(); ++p) {
+                if (origenTripleta(n, formula, p, basura).tripleta != M[p]) {
+                    return fallar("origenTripleta no coincide con la tripleta " + std::to_string(p));
+                }
+            }
+            if (satisfacible) {
+                if (!recuperarAsignacion(n, formula, matching, basura, 1).valida()) {
+                    return fallar("el matching encontrado no da una asignación que la satisfaga");
+                }
+                std::vector<uint64_t> construido = construirMatching(n, formula, asignacion, basura);
+                ResultadoRecuperacion r = recuperarAsignacion(n, formula, construido, basura, 1);
+                if (!r.valida() || r.asignacion != asignacion) {
+                    return fallar("el matching construido no devuelve su asignación");
+                }
+            }
+        }
+    }
+    return true;
+}
+
+ResultadoVerificacion verificarAleatorias(const OpcionesVerificacion& opciones) {
+    ResultadoVerificacion r;
+    if (opciones.maxVariables < 1 || opciones.maxVariables > 24 || opciones.maxClausulas < 1) return r;
+
+    auto inicio = std::chrono::steady_clock::now();
+    std::atomic<uint64_t> satisfacibles{0}, fallos{0};
+    std::mutex mutex;
+    unsigned hilos = hilosPara(opciones.casos, opciones.hilos, 1);
+
+    enParalelo(hilos, [&](unsigned h) {
+        for (uint64_t i = h; i < opciones.casos; i += hilos) {
+            uint64_t semilla = semillaInstancia(opciones.semilla, i);
+            GeneradorAleatorio g(semilla);
+            int n = 1 + (int)g.uniforme((uint32_t)opciones.maxVariables);
+            int m = 1 + (int)g.uniforme((uint32_t)opciones.maxClausulas);
+            std::vector<Clausula> formula = formulaPrueba(n, m, g);
+
+            if (satisfacibleFuerzaBruta(n, formula)) ++satisfacibles;
+            std::string discrepancia;
+            if (!verificarFormula(n, formula, discrepancia)) {
+                ++fallos;
+                std::lock_guard<std::mutex> lock(mutex);
+                if (r.discrepancias.size() < MAX_DISCREPANCIAS) {
+                    r.discrepancias.push_back("caso " + std::to_string(i) + " (semilla " +
+                                              std::to_string(semilla) + "): " + discrepancia);
+                }
+            }
+        }
+    });
+
+    r.casos = opciones.casos;
+    r.satisfacibles = satisfacibles;
+    r.fallos = fallos;
+    r.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return r;
+}
+
+int probarEntrada(const uint8_t* datos, size_t tam) {
+    if (tam >= 4 && datos[0] == '3' && datos[1] == 'D' && datos[2] == 'M' && datos[3] == 'Z') {
+        std::vector<uint8_t> entrada(datos, datos + tam);
+        int n = 0, m = 0;
+        std::vector<TripletaCompacta> tripletas;
+        if (!CodificadorCompacto::decodificar(entrada, FUZZ_MAX_TRIPLETAS, n, m, tripletas)) return 0;
+        comprobar(tripletas.size() <= FUZZ_MAX_TRIPLETAS);
+
+        // Lo decodificado se vuelve a codificar y decodificar igual
+        uint64_t d = tamanoDimension(n, m);
+        for (const auto& t : tripletas) comprobar(t.w < d && t.x < d && t.y < d);
+        int n2 = 0, m2 = 0;
+        std::vector<TripletaCompacta> otra;
+        comprobar(CodificadorCompacto::decodificar(CodificadorCompacto::codificar(n, m, tripletas), tripletas.size(), n2,
+                                                   m2, otra));
+        comprobar(n2 == n && m2 == m && otra == tripletas);
+        return 0;
+    }
+
+    if (tam >= 4 && datos[0] == '3' && datos[1] == 'D' && datos[2] == 'M' && datos[3] == 'M') {
+        std::vector<uint64_t> matching;
+        std::string error;
+        bool leido = decodificarMatching(std::vector<uint8_t>(datos, datos + tam), matching, error);
+        comprobar(leido == error.empty() && (leido || matching.empty()));
+        return 0;
+    }
+
+    JsonUtils::FormulaData data = JsonUtils::leerFormulaJsonTexto(std::string((const char*)datos, tam));
+    comprobar(data.exito == data.error.empty());
+    if (!data.exito) {
+        comprobar(data.numVars == 0 && data.clausulas.empty());
+        return 0;
+    }
+    comprobar(data.numVars > 0 && !data.clausulas.empty());
+
+    std::string error;
+    if (!JsonUtils::literalesValidos(data, error) || data.numVars > FUZZ_MAX_VARIABLES ||
+        data.clausulas.size() > (size_t)FUZZ_MAX_CLAUSULAS) {
+        return 0;
+    }
+    comprobar(verificarFormula(data.numVars, data.clausulas, error));
+    return 0;
+}
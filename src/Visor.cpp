@@ -0,0 +1,188 @@
+/**
+ * @file Visor.cpp
+ * @brief Implementación del visor paginado del conjunto M
+ * @author Proyecto de Complejidad Computacional
+ * @date 2025
+ */
+
+#include "Visor.h"
+#include "NucleoReduccion.h"
+#include <string>
+
+namespace {
+
+// Sólo se construyen los nombres de las tripletas que se muestran
+void escribirTripleta(std::ostream& out, const InstanciaVista& instancia, uint64_t i) {
+    Tripleta t = aTripleta(instancia.tripletas[i], instancia.n, instancia.m);
+    out << "  #" << i << " [" << t.tipo << "]: (" << t.w << ", " << t.x << ", " << t.y << ")\n";
+}
+
+} // namespace
+
+ResumenInstancia resumenInstancia(int n, int m, VarianteBasura basura) {
+    ResumenInstancia r;
+    r.n = n;
+    r.m = m;
+    r.basura = basura;
+    r.elementosPorDimension = tamanoDimension(n, m);
+    r.tripletasAnillo = numTripletasAnillos(n, m);
+    r.tripletasClausula = numTripletasClausulas(m);
+    r.tripletasBasura = numTripletasBasura(n, m, basura);
+    r.tripletas = numTripletas(n, m, basura);
+    r.matching = tamanoMatchingPerfecto(n, m);
+    r.bytesCompactos = r.tripletas * sizeof(TripletaCompacta);
+    return r;
+}
+
+void mostrarResumen(std::ostream& out, const ResumenInstancia& r) {
+    out << "Variables:              " << r.n << "\n";
+    out << "Cláusulas:              " << r.m << "\n";
+    out << "Basura:                 " << (r.basura == BASURA_POR_ETAPA ? "por etapa" : "completa") << "\n";
+    out << "Elementos por dimensión: " << r.elementosPorDimension << "\n";
+    out << "Tripletas:              " << r.tripletas << "\n";
+    out << "  Anillos:              " << r.tripletasAnillo << "\n";
+    out << "  Cláusulas:            " << r.tripletasClausula << "\n";
+    out << "  Basura:               " << r.tripletasBasura << "\n";
+    out << "Matching perfecto:      " << r.matching << " tripletas\n";
+    out << "Memoria compacta:       " << (r.bytesCompactos >> 10) << " KB\n";
+}
+
+Visor::Visor(const InstanciaVista& inst, const FiltroVisor& f) : instancia(inst), filtro(f) {
+    const int n = instancia.n, m = instancia.m;
+    const uint64_t tam = instancia.tripletas.size();
+    if (tam == numTripletas(n, m, BASURA_COMPLETA)) {
+        ordenReduccion = true;
+    } else if (tam == numTripletas(n, m, BASURA_POR_ETAPA)) {
+        ordenReduccion = true;
+        basura = BASURA_POR_ETAPA;
+    }
+
+    inicio = 0;
+    fin = tam;
+    if (filtro.dimension >= 0) {
+        porElemento = true;
+        if (filtro.dimension <= IndiceTripletas::DIMENSION_Y && indice.construir(instancia) &&
+            filtro.elemento < indice.tamanoDimension()) {
+            listaElemento = indice.de((IndiceTripletas::Dimension)filtro.dimension, filtro.elemento);
+        }
+        return;
+    }
+    if (!ordenReduccion) return;
+
+    // Orden de la reducción: anillos [0, a), cláusulas [a, c), basura [c, tam)
+    const uint64_t a = numTripletasAnillos(n, m);
+    const uint64_t c = a + numTripletasClausulas(m);
+    bool variableCubierta = filtro.variable == 0;
+    if (filtro.clausula > 0) {
+        bool valida = filtro.clausula <= m && (filtro.tipo == FiltroVisor::TODAS || filtro.tipo == FiltroVisor::CLAUSULA);
+        inicio = valida ? a + 3 * (uint64_t)(filtro.clausula - 1) : 0;
+        fin = valida ? inicio + 3 : 0;
+    } else if (filtro.tipo == FiltroVisor::ANILLO) {
+        fin = a;
+        if (filtro.variable >= 1 && filtro.variable <= n) {
+            inicio = 2 * (uint64_t)m * (filtro.variable - 1);
+            fin = inicio + 2 * (uint64_t)m;
+            variableCubierta = true;
+        }
+    } else if (filtro.tipo == FiltroVisor::CLAUSULA) {
+        inicio = a;
+        fin = c;
+    } else if (filtro.tipo == FiltroVisor::BASURA) {
+        inicio = c;
+    }
+    todasCoinciden = variableCubierta;
+}
+
+bool Visor::coincide(const TripletaCompacta& t) const {
+    const uint32_t nm = (uint32_t)instancia.n * (uint32_t)instancia.m;
+    const uint32_t m = (uint32_t)instancia.m;
+    if (filtro.tipo != FiltroVisor::TODAS) {
+        FiltroVisor::Tipo tipo = t.x < nm ? FiltroVisor::ANILLO
+                               : t.x < nm + m ? FiltroVisor::CLAUSULA
+                               : FiltroVisor::BASURA;
+        if (tipo != filtro.tipo) return false;
+    }
+    if (filtro.clausula > 0 && t.x != nm + (uint32_t)(filtro.clausula - 1)) return false;
+    // Toda tripleta tiene en W un tip, y el tip identifica su variable
+    if (filtro.variable > 0 && t.w / 2 / m + 1 != (uint32_t)filtro.variable) return false;
+    return true;
+}
+
+size_t Visor::mostrar(std::ostream& out, uint64_t desde, size_t cuantas) {
+    size_t escritas = 0;
+    if (todasCoinciden) {
+        for (uint64_t k = desde; k < numCandidatas() && escritas < cuantas; ++k, ++escritas) {
+            escribirTripleta(out, instancia, candidata(k));
+        }
+        return escritas;
+    }
+
+    // Se parte de la última marca anterior a 'desde'
+    uint64_t k = 0, c = 0;
+    auto marca = marcas.upper_bound(desde);
+    if (marca != marcas.begin()) {
+        --marca;
+        k = marca->first;
+        c = marca->second;
+    }
+    for (; c < numCandidatas() && escritas < cuantas; ++c) {
+        uint64_t i = candidata(c);
+        if (!coincide(instancia.tripletas[i])) continue;
+        if (k >= desde) {
+            escribirTripleta(out, instancia, i);
+            ++escritas;
+        }
+        ++k;
+    }
+    marcas[k] = c;
+    if (c == numCandidatas()) total = k;
+    return escritas;
+}
+
+uint64_t Visor::contar() {
+    if (todasCoinciden) return numCandidatas();
+    if (total != UINT64_MAX) return total;
+
+    uint64_t k = 0, c = 0;
+    if (!marcas.empty()) {
+        k = marcas.rbegin()->first;
+        c = marcas.rbegin()->second;
+    }
+    for (; c < numCandidatas(); ++c) {
+        k += coincide(instancia.tripletas[candidata(c)]);
+    }
+    total = k;
+    return total;
+}
+
+void Visor::paginar(std::istream& in, std::ostream& out, size_t porPagina) {
+    if (porPagina == 0) porPagina = 1;
+    uint64_t pagina = 0;
+    while (true) {
+        out << "\n── Página " << pagina + 1;
+        if (todasCoinciden || total != UINT64_MAX) {
+            out << " de " << (contar() + porPagina - 1) / porPagina;
+        }
+        out << " ──\n";
+        size_t escritas = mostrar(out, pagina * porPagina, porPagina);
+        if (escritas == 0) out << "  (no hay tripletas en esta página)\n";
+        bool ultima = escritas < porPagina;
+
+        out << (ultima ? "[p] anterior, [número] ir a página, [q/Enter] salir: "
+                       : "[Enter] siguiente, [p] anterior, [número] ir a página, [q] salir: ") << std::flush;
+        std::string linea;
+        if (!std::getline(in, linea) || linea == "q" || (linea.empty() && ultima)) break;
+        if (linea.empty()) {
+            ++pagina;
+        } else if (linea == "p") {
+            if (pagina > 0) --pagina;
+        } else {
+            try {
+                uint64_t destino = std::stoull(linea);
+                pagina = destino > 0 ? destino - 1 : 0;
+            } catch (const std::exception&) {
+                out << "Opción no reconocida: " << linea << "\n";
+            }
+        }
+    }
+}
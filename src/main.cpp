@@ -9,12 +9,18 @@
 #include "Utils.h"
 #include "UI.h"
 #include "FormulaHandler.h"
+#include "CLI.h"
 #include <iostream>
 #include <vector>
 #include <string>
 #include <unistd.h>
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Con argumentos se ejecuta en modo no interactivo
+    if (argc > 1) {
+        return ejecutarLineaComandos(argc, argv);
+    }
+    
     limpiarPantalla();
     mostrarBanner();
     pausar(800);